@@ -0,0 +1,127 @@
+// AdmissionFilter.h
+// The admission filter decides whether a Data packet a router caches on its path may displace a cached one, as TinyLFU does,
+// see Einziger, Friedman and Manes's "TinyLFU: A Highly Efficient Cache Admission Policy". The router records the name of every
+// Data packet requested from it. The first request of a name only sets its bits in the doorkeeper, a Bloom filter, and the later
+// ones are counted by a frequency sketch, see FrequencySketch.h, so the names requested once, which are most of them, take no
+// counter. A Data packet is admitted if its name has been requested at least cacheAdmissionFrequency times lately, counting the
+// request it answers. The doorkeeper is cleared whenever the sketch halves its counters, so both forget the old requests together.
+#ifndef ADMISSION_FILTER_H
+#define ADMISSION_FILTER_H
+
+//#include <vld.h>
+
+#include <vector>
+
+#include "FrequencySketch.h"
+#include "NameTable.h"
+using namespace std;
+
+extern int cacheAdmissionFrequency;
+
+class AdmissionFilter
+{
+	public:
+	AdmissionFilter()
+	{
+		m_sketch = FrequencySketch();
+		m_doorkeeper = vector<unsigned long long>();
+		m_mask = 0;
+		m_dataPacketsNum = -1;
+	}
+
+	/**
+	<@function. ensureCapacity
+	<@brief. Size the filter for a content store of a number of Data packets. The doorkeeper takes 8 bits for every request the
+		sketch counts before it halves its counters. If the filter is resized, the requests recorded so far are dropped.
+	*/
+	void ensureCapacity(int dataPacketsNum)
+	{
+		if(dataPacketsNum <= m_dataPacketsNum)
+			return;
+		m_dataPacketsNum = dataPacketsNum;
+		int width = 16;
+		while(width < dataPacketsNum)
+			width *= 2;
+		if(!m_doorkeeper.empty() && (int)m_doorkeeper.size()*64 >= 80*width)
+			return;
+		m_sketch = FrequencySketch();
+		m_sketch.ensureCapacity(width);
+		int bitsNum = 64;
+		while(bitsNum < 80*width)
+			bitsNum *= 2;
+		m_doorkeeper = vector<unsigned long long>(bitsNum/64, 0);
+		m_mask = bitsNum - 1;
+	}
+
+	/**
+	<@function. record
+	<@brief. Record a request of a name.
+	*/
+	void record(const Name& name)
+	{
+		if(m_doorkeeper.empty())
+			ensureCapacity(0);
+		unsigned long long hash = NameHash()(name);
+		if(!doorkeeperContains(hash))
+		{
+			for(int k = 0; k < hashesNum; ++k)
+			{
+				unsigned long long bit = getBit(hash, k);
+				m_doorkeeper[bit >> 6] |= 1ULL << (bit & 63);
+			}
+			return;
+		}
+		if(m_sketch.increment(name))
+			fill(m_doorkeeper.begin(), m_doorkeeper.end(), 0);
+	}
+
+	/**
+	<@function. estimate
+	<@brief. Estimate the number of requests of a name recorded lately.
+	*/
+	int estimate(const Name& name) const
+	{
+		if(m_doorkeeper.empty())
+			return 0;
+		return doorkeeperContains(NameHash()(name)) ? 1 + m_sketch.estimate(name) : 0;
+	}
+
+	/**
+	<@function. admits
+	<@brief. Check if a Data packet may displace the cached ones.
+	*/
+	bool admits(const Name& name) const
+	{
+		return estimate(name) >= cacheAdmissionFrequency;
+	}
+
+	private:
+	bool doorkeeperContains(unsigned long long hash) const
+	{
+		for(int k = 0; k < hashesNum; ++k)
+		{
+			unsigned long long bit = getBit(hash, k);
+			if(!(m_doorkeeper[bit >> 6] & (1ULL << (bit & 63))))
+				return false;
+		}
+		return true;
+	}
+
+	unsigned long long getBit(unsigned long long hash, int k) const
+	{
+		unsigned long long key = hash ^ (k + 1)*0xc2b2ae3d27d4eb4fULL;
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdULL;
+		key ^= key >> 33;
+		return key & m_mask;
+	}
+
+	static const int hashesNum = 3;	//<@brief. The number of bits a name sets in the doorkeeper.
+
+	FrequencySketch m_sketch;	//<@brief. Counts the requests of a name after the first one.
+	vector<unsigned long long> m_doorkeeper;	//<@brief. The bits of the doorkeeper Bloom filter.
+	unsigned long long m_mask;	//<@brief. The number of bits of the doorkeeper, a power of two, minus 1.
+	int m_dataPacketsNum;	//<@brief. The largest number of Data packets the filter has been sized for, or -1.
+};
+
+#endif
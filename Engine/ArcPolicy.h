@@ -0,0 +1,117 @@
+// ArcPolicy.h
+// The adaptive replacement cache of Megiddo and Modha's "ARC: A Self-Tuning, Low Overhead Replacement Cache". The Data packets
+// used once since they were cached are kept in the recency list T1, and those used again in the frequency list T2, both in
+// LRU order. The names of the Data packets evicted from either list are remembered in the ghost lists B1 and B2. Caching a
+// Data packet remembered in B1 shows T1 is too small, and one remembered in B2 that T2 is, so the target size of T1 is moved
+// accordingly, and the victim is taken from T1 if T1 is beyond its target, or from T2 otherwise. The target and the ghost
+// lists are bounded by the size of the cache, the number of Data packets the content store holds when it is full.
+#ifndef ARC_POLICY_H
+#define ARC_POLICY_H
+
+//#include <vld.h>
+
+#include <algorithm>
+
+#include "ReplacementPolicy.h"
+using namespace std;
+
+class ArcPolicy : public ReplacementPolicy
+{
+	public:
+	ArcPolicy()
+	{
+		m_lists = SlotLists(2);
+		m_b1 = GhostList();
+		m_b2 = GhostList();
+		m_target = 0;
+		m_capacity = 0;
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new ArcPolicy(*this);
+	}
+
+	void setCapacity(int dataPacketsNum)
+	{
+		m_capacity = dataPacketsNum;
+		m_target = min(m_target, m_capacity);
+		trimGhosts();
+	}
+
+	void insert(int slot, const Name& name, bool atFront)
+	{
+		if(m_b1.contains(name))
+		{
+			m_target = min(m_capacity, m_target + max(1, m_b2.size()/m_b1.size()));
+			m_b1.remove(name);
+			m_lists.pushFront(t2, slot);
+		}
+		else if(m_b2.contains(name))
+		{
+			m_target = max(0, m_target - max(1, m_b1.size()/m_b2.size()));
+			m_b2.remove(name);
+			m_lists.pushFront(t2, slot);
+		}
+		else if(atFront)
+			m_lists.pushFront(t1, slot);
+		else m_lists.pushBack(t1, slot);
+		trimGhosts();
+	}
+
+	void access(int slot, const Name&)
+	{
+		m_lists.moveToFront(t2, slot);
+	}
+
+	int victim()
+	{
+		if(0 < m_lists.size(t1) && (m_lists.size(t1) > m_target || 0 == m_lists.size(t2)))
+			return m_lists.back(t1);
+		return m_lists.back(t2);
+	}
+
+	void erase(int slot, const Name& name)
+	{
+		if(t1 == m_lists.getList(slot))
+			m_b1.pushFront(name);
+		else m_b2.pushFront(name);
+		m_lists.remove(slot);
+		trimGhosts();
+	}
+
+	int first() const
+	{
+		return m_lists.first();
+	}
+
+	int next(int slot) const
+	{
+		return m_lists.next(slot);
+	}
+
+	private:
+	/**
+	<@function. trimGhosts
+	<@brief. Bound the ghost lists as ARC does: T1 and B1 together hold no more than the cache size, and all four lists no more than
+		twice the cache size.
+	*/
+	void trimGhosts()
+	{
+		while(0 < m_b1.size() && m_lists.size(t1) + m_b1.size() > m_capacity)
+			m_b1.popBack();
+		while(0 < m_b2.size() && m_lists.size(t1) + m_lists.size(t2) + m_b1.size() + m_b2.size() > 2*m_capacity)
+			m_b2.popBack();
+	}
+
+	static const int t2 = 0;	//<@brief. The list of the Data packets used more than once, walked first.
+	static const int t1 = 1;	//<@brief. The list of the Data packets used once.
+
+	SlotLists m_lists;	//<@brief. The lists T2 and T1, each from the most recently used slot to the least recently used one.
+	GhostList m_b1;	//<@brief. The names of the Data packets evicted from T1.
+	GhostList m_b2;	//<@brief. The names of the Data packets evicted from T2.
+	int m_target;	//<@brief. The target size of T1.
+	int m_capacity;	//<@brief. The size of the cache, i.e., the number of Data packets the content store holds when it is full.
+};
+
+#endif
@@ -0,0 +1,60 @@
+// CachePolicy.h
+// The caching policies of the routing schemes. A policy is a type the node is instantiated with, and the node picks the code
+// of its policy by overloading on it, so the choice is made at compile time and costs nothing per packet.
+// SelectiveCaching is the caching of SelSta and SADO: an Interest packet elects a single router on its path by the hash values
+// the routers bid with, and only that router caches the response Data packet. The other policies cache a passing Data packet on
+// every router of its path: AlwaysCaching caches it always, as PerSta does, and ProbabilisticCaching caches it with a fixed
+// probability, as ProSta does.
+#ifndef CACHE_POLICY_H
+#define CACHE_POLICY_H
+
+//#include <vld.h>
+
+#include <ratio>
+
+#include "Random.h"
+using namespace std;
+
+struct SelectiveCaching
+{
+};
+
+/**
+<@brief. The base of the policies that cache the Data packets on their path. The content store evicts the least recently used
+	Data packets to make room for a new one.
+*/
+struct OnPathCaching
+{
+};
+
+struct AlwaysCaching : public OnPathCaching
+{
+	/**
+	<@function. admits
+	<@brief. Decide whether a router caches a passing Data packet.
+	<@param. random, the random number stream of the router.
+	*/
+	static bool admits(Random&)
+	{
+		return true;
+	}
+
+	static const bool cachesAtFront = true;	//<@brief. Whether a newly cached Data packet is put at the most recently used end.
+};
+
+/**
+<@brief. Cache a passing Data packet with the probability Probability, a std::ratio. The newly cached Data packets are put at the
+	least recently used end of the content store, as ProSta has always put them.
+*/
+template<class Probability>
+struct ProbabilisticCaching : public OnPathCaching
+{
+	static bool admits(Random& random)
+	{
+		return (float)random.uniform() <= (float)Probability::num/Probability::den;
+	}
+
+	static const bool cachesAtFront = false;
+};
+
+#endif
@@ -0,0 +1,127 @@
+// CachingHash.h
+// The caching hash gives the hash value a router bids with in the election of the caching router of an Interest packet.
+// The value depends only on the router and the requested file. In the compatible mode it is the hash of the router's salt,
+// i.e., the string generateRandomString(id, 10), followed by the file name, exactly as the routers have always computed it;
+// the hash is a loop over the bytes, so the state it reaches after the salt is kept for every router and the loop resumes
+// from it over the file name. In the seeded mode it is a 64-bit mix of a seed of the router and the ID of the file in the
+// name table, which takes a few multiplications and no memory access but the seed, and elects different routers.
+#ifndef CACHING_HASH_H
+#define CACHING_HASH_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <string>
+
+#include "NameTable.h"
+#include "Random.h"
+#include "utility.h"
+using namespace std;
+
+class CachingHash
+{
+	public:
+	enum Mode{compatible, seeded};
+
+	CachingHash()
+	{
+		m_mode = compatible;
+		m_saltStates = vector<unsigned>();
+		m_seeds = vector<unsigned long long>();
+	}
+
+	/**
+	<@function. init
+	<@brief. Compute the salt of every router.
+	<@param. nodesNum, the total number of nodes in the network.
+	<@param. mode, how the hash values are computed.
+	<@param. random, the random number stream the seeds of the routers are drawn from, for the seeded mode.
+	*/
+	void init(int nodesNum, Mode mode, Random random)
+	{
+		m_mode = mode;
+		m_saltStates = vector<unsigned>(nodesNum);
+		m_seeds = vector<unsigned long long>(nodesNum);
+		for(int id = 0; id < nodesNum; ++id)
+		{
+			m_saltStates[id] = resume(31, generateRandomString(id, 10));
+			m_seeds[id] = random.next();
+		}
+	}
+
+	/**
+	<@function. hash
+	<@brief. Get the hash value a router bids with for a file.
+	<@param. id, the ID of the router.
+	<@param. fileId, the ID of the requested file in the name table.
+	<@return. A value in the range of [0, 2^32).
+	*/
+	float hash(int id, int fileId) const
+	{
+		if(compatible == m_mode)
+			return float(resume(m_saltStates[id], nameTable.getFileName(fileId)));
+		return mix(m_seeds[id], fileId);
+	}
+
+	/**
+	<@function. hash
+	<@brief. Get the hash values a router bids with for a batch of files. In the seeded mode the files are hashed
+		independently of each other by a loop without branches, which the compiler vectorizes.
+	<@param. id, the ID of the router.
+	<@param. fileIds, the IDs of the requested files in the name table.
+	<@param. filesNum, the number of files in the batch.
+	<@param. hashValues, the array the hash values are written into, in the order of the files.
+	*/
+	void hash(int id, const int* fileIds, int filesNum, float* hashValues) const
+	{
+		if(compatible == m_mode)
+		{
+			unsigned saltState = m_saltStates[id];
+			for(int i = 0; i < filesNum; ++i)
+				hashValues[i] = float(resume(saltState, nameTable.getFileName(fileIds[i])));
+			return;
+		}
+		unsigned long long seed = m_seeds[id];
+		for(int i = 0; i < filesNum; ++i)
+			hashValues[i] = mix(seed, fileIds[i]);
+	}
+
+	private:
+	/**
+	<@function. resume
+	<@brief. Run the hash of hashStringToNum over a string, starting from the given state.
+	*/
+	static unsigned resume(unsigned state, const string& str)
+	{
+		const unsigned a = 54059;
+		const unsigned b = 76963;
+		for(string::const_iterator iter(str.begin()), end(str.end());
+			iter != end; ++iter)
+		{
+			unsigned temp = *iter;
+			state = (state*a) ^ (temp*b);
+		}
+		return state;
+	}
+
+	/**
+	<@function. mix
+	<@brief. Hash a file ID under a seed by the finalizer of splitmix64, keeping the high 32 bits.
+	*/
+	static float mix(unsigned long long seed, int fileId)
+	{
+		unsigned long long z = seed + (unsigned long long)(unsigned)fileId*0x9e3779b97f4a7c15ULL;
+		z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+		z = z ^ (z >> 31);
+		return float(unsigned(z >> 32));
+	}
+
+	Mode m_mode;	//<@brief. How the hash values are computed.
+	vector<unsigned> m_saltStates;	//<@brief. The state of the hash after the salt of every router, for the compatible mode.
+	vector<unsigned long long> m_seeds;	//<@brief. The seed of every router, for the seeded mode.
+};
+
+extern CachingHash cachingHash;
+
+#endif
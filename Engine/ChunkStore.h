@@ -0,0 +1,464 @@
+// ChunkStore.h
+// The chunk store keeps the cached Data packets of a content store organized by file. There is one record per file the content
+// store holds chunks of, with a bitmap of the chunks held and the metadata of those chunks in a compact array in the order of
+// their numbers, so a chunk is found by a bit test and the population count of the bits before it. A cached chunk keeps only what
+// a hit returns and an eviction needs: the forwarding state of a Data packet, i.e., its arrival face, hop count and ID, is set
+// anew every time it is returned, and its weight is looked up by the replacement policy. The relevant router lists of the chunks
+// of a file are kept once per distinct list in the record and shared by the chunks and the Data packets returned; the lists are
+// found by their hashes, so interning one does not scan the lists of the file. Caching or evicting a chunk shifts the metadata
+// of the chunks of its file numbered after it, which takes time linear in the number of chunks of the file cached, a few dozen
+// bytes each, and keeps the array compact.
+#ifndef CHUNK_STORE_H
+#define CHUNK_STORE_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <cstring>
+
+#include "DataPacket.h"
+#include "NameTable.h"
+#include "components.h"
+using namespace std;
+
+class ChunkStore
+{
+	public:
+	ChunkStore()
+	{
+		m_records = vector<FileRecord>();
+		m_fileRecords = unordered_map<int, int>();
+		m_freeRecords = vector<int>();
+		m_relevantRouterIndex = unordered_multimap<unsigned long long, pair<int, int> >();
+		m_chunksNum = 0;
+	}
+
+	/**
+	<@function. find
+	<@brief. Look up the slot of a cached chunk, or -1 if the chunk is not cached.
+	*/
+	int find(const Name& name) const
+	{
+		int record, position;
+		if(!locate(name, record, position))
+			return -1;
+		return m_records[record].m_chunks[position].m_slot;
+	}
+
+	/**
+	<@function. insert
+	<@brief. Cache a Data packet. There must be no cached chunk with the same name.
+	<@param. dataPacket, the Data packet.
+	<@param. slot, the slot of the content store the chunk takes.
+	*/
+	void insert(const DataPacket& dataPacket, int slot)
+	{
+		const Name& name = dataPacket.getName();
+		unordered_map<int, int>::iterator iter = m_fileRecords.find(name.fileId);
+		int record;
+		if(m_fileRecords.end() != iter)
+			record = iter->second;
+		else
+		{
+			record = allocateRecord();
+			m_fileRecords[name.fileId] = record;
+		}
+		FileRecord& fileRecord = m_records[record];
+		int word = name.chunkNo >> 6;
+		if(word >= (int)fileRecord.m_bitmap.size())
+			fileRecord.m_bitmap.resize(word + 1, 0);
+		fileRecord.m_bitmap[word] |= 1ULL << (name.chunkNo & 63);
+		Chunk chunk;
+		chunk.m_slot = slot;
+		chunk.m_size = dataPacket.getSize();
+		chunk.m_reuseTime = dataPacket.getReuseTime();
+		chunk.m_cachingRouterId = dataPacket.getCachingRouterId();
+		chunk.m_currentRouterDist = dataPacket.getCurrentRouterDist();
+		chunk.m_cachingRouterDist = dataPacket.getCachingRouterDist();
+		chunk.m_type = dataPacket.getType();
+		chunk.m_relevantRouters = internRelevantRouters(name.fileId, fileRecord, dataPacket.shareRelevantRouters());
+		fileRecord.m_chunks.insert(fileRecord.m_chunks.begin() + rank(fileRecord, name.chunkNo), chunk);
+		string payload = dataPacket.getPayload();
+		if(!payload.empty())
+			fileRecord.m_payloads.push_back(make_pair(name.chunkNo, payload));
+		++m_chunksNum;
+	}
+
+	/**
+	<@function. get
+	<@brief. Get a cached chunk as a Data packet. The chunk must be cached.
+	*/
+	DataPacket get(const Name& name) const
+	{
+		int record, position;
+		locate(name, record, position);
+		return toDataPacket(name, m_records[record], position);
+	}
+
+	/**
+	<@function. take
+	<@brief. Take a cached chunk out of the store. The chunk must be cached.
+	<@return. The chunk as a Data packet.
+	*/
+	DataPacket take(const Name& name)
+	{
+		int record, position;
+		locate(name, record, position);
+		FileRecord& fileRecord = m_records[record];
+		DataPacket dataPacket = toDataPacket(name, fileRecord, position);
+		releaseRelevantRouters(name.fileId, fileRecord, fileRecord.m_chunks[position].m_relevantRouters);
+		fileRecord.m_chunks.erase(fileRecord.m_chunks.begin() + position);
+		fileRecord.m_bitmap[name.chunkNo >> 6] &= ~(1ULL << (name.chunkNo & 63));
+		for(vector<pair<int, string> >::iterator iter(fileRecord.m_payloads.begin()), end(fileRecord.m_payloads.end());
+			iter != end; ++iter)
+		{
+			if(iter->first == name.chunkNo)
+			{
+				fileRecord.m_payloads.erase(iter);
+				break;
+			}
+		}
+		--m_chunksNum;
+		if(fileRecord.m_chunks.empty())
+		{
+			m_fileRecords.erase(name.fileId);
+			FileRecord().swap(fileRecord);	// Free the memory of the record.
+			m_freeRecords.push_back(record);
+		}
+		return dataPacket;
+	}
+
+	/**
+	<@function. increaseReuseTime
+	<@brief. Count a reuse of a cached chunk. The chunk must be cached.
+	*/
+	void increaseReuseTime(const Name& name)
+	{
+		int record, position;
+		locate(name, record, position);
+		++m_records[record].m_chunks[position].m_reuseTime;
+	}
+
+	/**
+	<@function. getReuseTime
+	<@brief. Get the number of times a cached chunk has been reused. The chunk must be cached.
+	*/
+	int getReuseTime(const Name& name) const
+	{
+		int record, position;
+		locate(name, record, position);
+		return m_records[record].m_chunks[position].m_reuseTime;
+	}
+
+	/**
+	<@function. addRelevantRouters
+	<@brief. Add a list of FaceMetric to the relevant router list of a cached chunk. The chunk must be cached.
+	*/
+	void addRelevantRouters(const Name& name, const vector<FaceMetric>& relevantRouters)
+	{
+		if(relevantRouters.empty())
+			return;
+		int record, position;
+		locate(name, record, position);
+		FileRecord& fileRecord = m_records[record];
+		Chunk& chunk = fileRecord.m_chunks[position];
+		shared_ptr<vector<FaceMetric> > ownRelevantRouters = fileRecord.m_relevantRouters[chunk.m_relevantRouters];
+		shared_ptr<vector<FaceMetric> > newRelevantRouters = ownRelevantRouters ?
+			make_shared<vector<FaceMetric> >(*ownRelevantRouters) : make_shared<vector<FaceMetric> >();
+		newRelevantRouters->insert(newRelevantRouters->end(), relevantRouters.begin(), relevantRouters.end());
+		releaseRelevantRouters(name.fileId, fileRecord, chunk.m_relevantRouters);
+		chunk.m_relevantRouters = internRelevantRouters(name.fileId, fileRecord, newRelevantRouters);
+	}
+
+	/**
+	<@function. getChunksNum
+	<@brief. Get the number of cached chunks of a file.
+	*/
+	int getChunksNum(int fileId) const
+	{
+		unordered_map<int, int>::const_iterator iter = m_fileRecords.find(fileId);
+		return m_fileRecords.end() == iter ? 0 : m_records[iter->second].m_chunks.size();
+	}
+
+	/**
+	<@function. getStat
+	<@brief. Get how many chunks of every file are cached, in increasing order of the file IDs. The files are sorted, which takes
+		O(k log k) time for k files.
+	<@param. stat, a reference variable, the statistics will be stored in it.
+	*/
+	void getStat(vector<ContentStoreStat>& stat) const
+	{
+		stat.clear();
+		for(unordered_map<int, int>::const_iterator iter(m_fileRecords.begin()), end(m_fileRecords.end());
+			iter != end; ++iter)
+		{
+			ContentStoreStat statItem;
+			statItem.fileId = iter->first;
+			statItem.count = m_records[iter->second].m_chunks.size();
+			stat.push_back(statItem);
+		}
+		sort(stat.begin(), stat.end(), compareStatFiles);
+	}
+
+	/**
+	<@function. size
+	<@brief. Get the number of cached chunks.
+	*/
+	int size() const
+	{
+		return m_chunksNum;
+	}
+
+	private:
+	/**
+	<@brief. The metadata of a cached chunk.
+	*/
+	struct Chunk
+	{
+		int m_slot;	//<@brief. The slot of the content store the chunk takes.
+		int m_size;	//<@brief. The size of the Data packet.
+		int m_reuseTime;	//<@brief. The number of times the chunk has been reused.
+		int m_cachingRouterId;	//<@brief. The caching router of the Data packet.
+		short m_currentRouterDist;	//<@brief. The currentRouterDist value of the Data packet.
+		short m_cachingRouterDist;	//<@brief. The cachingRouterDist value of the Data packet.
+		int m_relevantRouters;	//<@brief. The relevant router list of the chunk in the record, 0 for none.
+		unsigned char m_type;	//<@brief. The type of the Data packet.
+	};
+
+	/**
+	<@brief. The cached chunks of a file.
+	*/
+	struct FileRecord
+	{
+		FileRecord() : m_relevantRouters(1), m_references(1, 0), m_relevantRouterHashes(1, 0)
+		{
+		}
+
+		void swap(FileRecord& other)
+		{
+			m_bitmap.swap(other.m_bitmap);
+			m_chunks.swap(other.m_chunks);
+			m_relevantRouters.swap(other.m_relevantRouters);
+			m_references.swap(other.m_references);
+			m_relevantRouterHashes.swap(other.m_relevantRouterHashes);
+			m_freeRelevantRouters.swap(other.m_freeRelevantRouters);
+			m_payloads.swap(other.m_payloads);
+		}
+
+		vector<unsigned long long> m_bitmap;	//<@brief. Bit i is set if the chunk i is cached.
+		vector<Chunk> m_chunks;	//<@brief. The cached chunks in increasing order of their numbers.
+		vector<shared_ptr<vector<FaceMetric> > > m_relevantRouters;	//<@brief. The distinct relevant router lists of the chunks, the
+			// empty list first. A list released by all the chunks is reset to null and reused.
+		vector<int> m_references;	//<@brief. The number of chunks sharing every relevant router list.
+		vector<unsigned long long> m_relevantRouterHashes;	//<@brief. The hash of every relevant router list, see hashRelevantRouters.
+		vector<int> m_freeRelevantRouters;	//<@brief. The relevant router lists reset to null, reused first.
+		vector<pair<int, string> > m_payloads;	//<@brief. The payloads of the chunks that have one, by chunk number. The producers send
+			// empty payloads, so it is normally empty.
+	};
+
+	/**
+	<@function. toDataPacket
+	<@brief. Make a Data packet of a cached chunk, at a position of the chunks of its record.
+	*/
+	static DataPacket toDataPacket(const Name& name, const FileRecord& fileRecord, int position)
+	{
+		const Chunk& chunk = fileRecord.m_chunks[position];
+		DataPacket dataPacket(name);
+		for(vector<pair<int, string> >::const_iterator iter(fileRecord.m_payloads.begin()), end(fileRecord.m_payloads.end());
+			iter != end; ++iter)
+		{
+			if(iter->first == name.chunkNo)
+				dataPacket.setPayload(iter->second);
+		}
+		dataPacket.setSize(chunk.m_size);
+		dataPacket.setReuseTime(chunk.m_reuseTime);
+		dataPacket.setCachingRouterId(chunk.m_cachingRouterId);
+		dataPacket.setCurrentRouterDist(chunk.m_currentRouterDist);
+		dataPacket.setCachingRouterDist(chunk.m_cachingRouterDist);
+		dataPacket.setType((DataPacket::Type)chunk.m_type);
+		dataPacket.setRelevantRouters(fileRecord.m_relevantRouters[chunk.m_relevantRouters]);
+		return dataPacket;
+	}
+
+	bool locate(const Name& name, int& record, int& position) const
+	{
+		unordered_map<int, int>::const_iterator iter = m_fileRecords.find(name.fileId);
+		if(m_fileRecords.end() == iter)
+			return false;
+		const FileRecord& fileRecord = m_records[iter->second];
+		int word = name.chunkNo >> 6;
+		if(name.chunkNo < 0 || word >= (int)fileRecord.m_bitmap.size()
+			|| !(fileRecord.m_bitmap[word] & (1ULL << (name.chunkNo & 63))))
+			return false;
+		record = iter->second;
+		position = rank(fileRecord, name.chunkNo);
+		return true;
+	}
+
+	/**
+	<@function. rank
+	<@brief. Count the cached chunks of a record numbered below a chunk number.
+	*/
+	static int rank(const FileRecord& fileRecord, int chunkNo)
+	{
+		int word = chunkNo >> 6;
+		int ret = 0;
+		for(int w = 0; w < word; ++w)
+			ret += countBits(fileRecord.m_bitmap[w]);
+		if(chunkNo & 63)
+			ret += countBits(fileRecord.m_bitmap[word] & ((1ULL << (chunkNo & 63)) - 1));
+		return ret;
+	}
+
+	static int countBits(unsigned long long word)
+	{
+#if defined(__GNUC__)
+		return __builtin_popcountll(word);
+#else
+		int count = 0;
+		for(; 0 != word; word &= word - 1)
+			++count;
+		return count;
+#endif
+	}
+
+	static bool compareStatFiles(const ContentStoreStat& left, const ContentStoreStat& right)
+	{
+		return left.fileId < right.fileId;
+	}
+
+	static bool sameRelevantRouters(const vector<FaceMetric>& left, const vector<FaceMetric>& right)
+	{
+		if(left.size() != right.size())
+			return false;
+		for(vector<FaceMetric>::size_type i = 0; i < left.size(); ++i)
+		{
+			if(left[i].router != right[i].router || left[i].faces != right[i].faces || left[i].metric != right[i].metric)
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	<@function. hashRelevantRouters
+	<@brief. Hash a relevant router list of a file, so that the equal lists of the file have the same hash.
+	*/
+	static unsigned long long hashRelevantRouters(int fileId, const vector<FaceMetric>& relevantRouters)
+	{
+		unsigned long long hash = 0xcbf29ce484222325ULL ^ (unsigned long long)fileId;
+		for(vector<FaceMetric>::const_iterator iter(relevantRouters.begin()), end(relevantRouters.end());
+			iter != end; ++iter)
+		{
+			hash = mix(hash, iter->router);
+			for(vector<int>::const_iterator faceIter(iter->faces.begin()), faceEnd(iter->faces.end());
+				faceIter != faceEnd; ++faceIter)
+				hash = mix(hash, *faceIter);
+			float metric = iter->metric + 0.0f;	// -0 and 0 are equal metrics.
+			unsigned int metricBits;
+			memcpy(&metricBits, &metric, sizeof(metricBits));
+			hash = mix(hash, metricBits);
+		}
+		return hash;
+	}
+
+	static unsigned long long mix(unsigned long long hash, unsigned long long value)
+	{
+		hash = (hash ^ value)*0x100000001b3ULL;
+		return hash ^ (hash >> 29);
+	}
+
+	/**
+	<@function. internRelevantRouters
+	<@brief. Find a relevant router list of a record equal to the given one, or add the given one, and count one more chunk sharing it.
+		The lists of the record are looked up by their hashes in m_relevantRouterIndex.
+	<@param. fileId, the file of the record.
+	<@return. The index of the list in the record.
+	*/
+	int internRelevantRouters(int fileId, FileRecord& fileRecord, const shared_ptr<vector<FaceMetric> >& relevantRouters)
+	{
+		if(!relevantRouters || relevantRouters->empty())
+			return 0;
+		unsigned long long hash = hashRelevantRouters(fileId, *relevantRouters);
+		pair<unordered_multimap<unsigned long long, pair<int, int> >::iterator, unordered_multimap<unsigned long long, pair<int, int> >::iterator> range =
+			m_relevantRouterIndex.equal_range(hash);
+		for(unordered_multimap<unsigned long long, pair<int, int> >::iterator iter(range.first); iter != range.second; ++iter)
+		{
+			int index = iter->second.second;
+			if(fileId == iter->second.first && (fileRecord.m_relevantRouters[index] == relevantRouters
+				|| sameRelevantRouters(*fileRecord.m_relevantRouters[index], *relevantRouters)))
+			{
+				++fileRecord.m_references[index];
+				return index;
+			}
+		}
+		int index;
+		if(fileRecord.m_freeRelevantRouters.empty())
+		{
+			index = fileRecord.m_relevantRouters.size();
+			fileRecord.m_relevantRouters.push_back(relevantRouters);
+			fileRecord.m_references.push_back(1);
+			fileRecord.m_relevantRouterHashes.push_back(hash);
+		}
+		else
+		{
+			index = fileRecord.m_freeRelevantRouters.back();
+			fileRecord.m_freeRelevantRouters.pop_back();
+			fileRecord.m_relevantRouters[index] = relevantRouters;
+			fileRecord.m_references[index] = 1;
+			fileRecord.m_relevantRouterHashes[index] = hash;
+		}
+		m_relevantRouterIndex.insert(make_pair(hash, make_pair(fileId, index)));
+		return index;
+	}
+
+	/**
+	<@function. releaseRelevantRouters
+	<@brief. Count one chunk fewer sharing a relevant router list of a record. A list no chunk shares any more is reset to null and
+		dropped from m_relevantRouterIndex.
+	*/
+	void releaseRelevantRouters(int fileId, FileRecord& fileRecord, int index)
+	{
+		if(0 == index || 0 != --fileRecord.m_references[index])
+			return;
+		unsigned long long hash = fileRecord.m_relevantRouterHashes[index];
+		pair<unordered_multimap<unsigned long long, pair<int, int> >::iterator, unordered_multimap<unsigned long long, pair<int, int> >::iterator> range =
+			m_relevantRouterIndex.equal_range(hash);
+		for(unordered_multimap<unsigned long long, pair<int, int> >::iterator iter(range.first); iter != range.second; ++iter)
+		{
+			if(fileId == iter->second.first && index == iter->second.second)
+			{
+				m_relevantRouterIndex.erase(iter);
+				break;
+			}
+		}
+		fileRecord.m_relevantRouters[index].reset();
+		fileRecord.m_freeRelevantRouters.push_back(index);
+	}
+
+	int allocateRecord()
+	{
+		if(m_freeRecords.empty())
+		{
+			m_records.push_back(FileRecord());
+			return m_records.size() - 1;
+		}
+		int record = m_freeRecords.back();
+		m_freeRecords.pop_back();
+		m_records[record] = FileRecord();
+		return record;
+	}
+
+	vector<FileRecord> m_records;	//<@brief. The records of the files, some of them free.
+	unordered_map<int, int> m_fileRecords;	//<@brief. Maps the ID of a file with cached chunks to its record.
+	vector<int> m_freeRecords;	//<@brief. The free records, reused first.
+	unordered_multimap<unsigned long long, pair<int, int> > m_relevantRouterIndex;	//<@brief. Maps the hash of every relevant router list
+		// of a record to the file of the record and the index of the list in it.
+	int m_chunksNum;	//<@brief. The number of cached chunks.
+};
+
+#endif
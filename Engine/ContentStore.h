@@ -0,0 +1,537 @@
+// ContentStore.h
+// The content store of a router. The Data packets are kept by file in a chunk store, see ChunkStore.h, every one taking a slot,
+// and the replacement policy the run is configured with, see ReplacementPolicies.h, keeps the order in which the slots are
+// evicted. The store counts its hits, misses and evictions, and, if replacementPolicyTiming is set, the time its policy takes.
+// The chunk store also tells how many chunks of every file it holds. If the admission filter is enabled, which the routers caching
+// on their paths do when cacheAdmission is set, the Data packets they cache pass it, see AdmissionFilter.h, before they may displace
+// cached ones.
+#ifndef CONTENT_STORE_H
+#define CONTENT_STORE_H
+//#include <vld.h>
+
+#include <list>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
+#include <fstream>
+#include <chrono>
+
+#include "DataPacket.h"
+#include "components.h"
+#include "utility.h"
+#include "FaceMetric.h"
+#include "ReplacementPolicies.h"
+#include "ChunkStore.h"
+#include "AdmissionFilter.h"
+using namespace std;
+
+extern vector<float> fileProbabilities;
+extern ofstream reuseTime;
+extern int responsePacketNum;
+extern long long cachedPacketNum;
+extern ReplacementPolicy::Type replacementPolicyType;
+extern bool replacementPolicyTiming;
+
+class ContentStore
+{
+	public:
+	ContentStore(long long capacity)
+	{
+		init(capacity);
+	}
+	ContentStore()
+	{
+		init(0);
+	}
+
+	ContentStore(const ContentStore& other)
+	{
+		*this = other;
+	}
+
+	ContentStore& operator=(const ContentStore& other)
+	{
+		if(this == &other)
+			return *this;
+		m_capacity = other.m_capacity;
+		m_chunks = other.m_chunks;
+		m_slotNames = other.m_slotNames;
+		m_freeSlots = other.m_freeSlots;
+		m_policy.reset(other.m_policy->clone());
+		m_remainderCapacity = other.m_remainderCapacity;
+		m_hitsNum = other.m_hitsNum;
+		m_missesNum = other.m_missesNum;
+		m_evictionsNum = other.m_evictionsNum;
+		m_policyNanoseconds = other.m_policyNanoseconds;
+		m_admission = other.m_admission;
+		m_admissionEnabled = other.m_admissionEnabled;
+		m_admissionCandidatesNum = other.m_admissionCandidatesNum;
+		m_admissionRejectionsNum = other.m_admissionRejectionsNum;
+		m_admissionNanoseconds = other.m_admissionNanoseconds;
+		return *this;
+	}
+
+	/**
+	<@function. setCapacity
+	<@bref. Set the capacity of content store.
+	<@param. capacity, the capacity of the content store that we will set it to be.
+	<@caution. If the reduction in the capacity is greater than the remainder capacity, 
+				the remainder capacity will have a minus value, which is an error.
+	*/
+	void setCapacity(long long capacity)
+	{
+		m_remainderCapacity += capacity - m_capacity;
+		m_capacity = capacity;
+		m_policy->setCapacity(getCapacityInDataPackets());
+		if(m_admissionEnabled)
+			m_admission.ensureCapacity(m_capacity/DataPacket::defaultSize);
+		//if(capacity > m_pStore->max_size())
+		//	m_pStore->resize(capacity);
+	}
+
+	/**
+	<@function. enableAdmission
+	<@brief. Make the Data packets admitted by admitDataPacket pass the admission filter, which is sized for the capacity of the content
+		store, and record every lookup in it.
+	*/
+	void enableAdmission()
+	{
+		m_admissionEnabled = true;
+		m_admission.ensureCapacity(m_capacity/DataPacket::defaultSize);
+	}
+	
+	/**
+	<@function getCapacity
+	<@brief Check the capacity of the content store.
+	*/
+	long long getCapacity() const
+	{
+		return m_capacity;
+	}
+	
+	/**
+	<@function getRemainderCapacity
+	<@brief Check the remaider capacity of the content store.
+	*/
+	long long getRemainderCapacity()
+	{
+		return m_remainderCapacity;
+	}
+	
+	/**
+	<@function doesExist
+	<@brief Check if there is a Data packet in the Content store with the given name
+	<@param The name will be checked aginst.
+	<@return true if does exist, or false if doesn't exist.
+	*/
+	bool DataPacketExist(const Name& name)
+	{
+		return -1 != findSlot(name);
+	} 
+	
+	/**
+	<@function getDataPacket
+	<@brief Extract a Data packet matching the given name from the content store.
+	<@param The name to be matched.
+	<@return Return the <true, matching Data packet> if it exists, otherwise return <false, default Data packet> 
+	<@besides If the matching Data packet exists, the replacement policy is told of the hit.
+	*/
+	pair<bool, DataPacket> getDataPacket(const Name& name)
+	{
+		if(m_admissionEnabled)
+		{
+			Stopwatch stopwatch(m_admissionNanoseconds);
+			m_admission.record(name);
+		}
+		int slot = findSlot(name);
+		if(-1 == slot)
+		{
+			++m_missesNum;
+			Stopwatch stopwatch(m_policyNanoseconds);
+			m_policy->miss(name);
+			return make_pair(false, DataPacket(name));
+		}
+		++m_hitsNum;
+		m_chunks.increaseReuseTime(name);
+		{
+			Stopwatch stopwatch(m_policyNanoseconds);
+			m_policy->access(slot, name);
+		}
+		return make_pair(true, m_chunks.get(name));
+	}
+	
+	/**
+	<@function dropDataPacket
+	<@brief Drop the Data packet the replacement policy chooses from the content store. The remaider capacity of the content store will be scaled.
+	*/
+	DataPacket dropDataPacket()
+	{
+		if(!empty())
+		{
+			DataPacket dataPacket = evict();
+			m_remainderCapacity += dataPacket.getSize();
+			if(responsePacketNum > 400000)
+				reuseTime << dataPacket.getReuseTime() << endl;
+			return dataPacket;
+		}
+		else return DataPacket();	// In fact the function returns nothing.
+	}
+	
+	/**
+	<@function. cacheDataPacket
+	<@brief. Cache a given Data packet.
+	<@param. dataPacket, the Data packet to be cached.
+	<@return. If the Data packet is cached successfully or there has been a Data packet in the content store, the function will retrun true.
+		Otherwise, the function will return false.
+	<@attention. If there is a Data packet with the same name in the content store, 
+				the original Data packet will be take to the head of the Data packet list.
+	*/
+	bool cacheDataPacket(DataPacket dataPacket)
+	{
+		float weight = fileProbabilities[dataPacket.getName().fileId];
+
+		dataPacket.setCurrentRouterDist(0);
+		dataPacket.setCachingRouterDist(0);
+		dataPacket.setArrivalFace(-1);
+		dataPacket.setHopCount(0);
+		dataPacket.setCachingRouterId(-1);
+		dataPacket.setWeight(weight);
+		dataPacket.setReuseTime(0);
+		int slot = findSlot(dataPacket.getName());
+		//The Data packet to be cached has been in the content store.
+		if(-1 != slot)
+		{
+			//cout << "They has already a Data packet " << dataPacket.getName() << " in the content store." << endl;
+			m_chunks.addRelevantRouters(dataPacket.getName(), dataPacket.getRelevantRouters());
+			Stopwatch stopwatch(m_policyNanoseconds);
+			m_policy->access(slot, dataPacket.getName());
+			return true;
+		}
+		// There are enough space to cache the Data packet.
+		if(m_remainderCapacity >= dataPacket.getSize())
+		{
+			insert(dataPacket, true);
+			m_remainderCapacity -= dataPacket.getSize();
+			if(responsePacketNum > 400000)
+			{
+				++cachedPacketNum;
+			}
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	<@function. admitDataPacket
+	<@brief. Cache a Data packet a router caches on its path. The Data packets the replacement policy chooses are evicted until it fits.
+	<@param. dataPacket, the Data packet to be cached.
+	<@param. atFront, whether the Data packet is given the most favourable position by the replacement policy, or the least favourable one,
+		e.g., the most recently used end of the content store or the least recently used end under LRU.
+	<@attention. If there is a Data packet with the same name in the content store,
+				the original Data packet will be take to the head of the Data packet list.
+				If the admission filter is enabled and the Data packet does not fit in the remainder capacity, it is cached only if the admission
+				filter admits it.
+	*/
+	void admitDataPacket(DataPacket dataPacket, bool atFront)
+	{
+		int slot = findSlot(dataPacket.getName());
+		dataPacket.setReuseTime(0);
+		//The Data packet to be cached has been in the content store.
+		if(-1 != slot)
+		{
+			Stopwatch stopwatch(m_policyNanoseconds);
+			m_policy->access(slot, dataPacket.getName());
+			return;
+		}
+		if(m_admissionEnabled && m_remainderCapacity < dataPacket.getSize())
+		{
+			++m_admissionCandidatesNum;
+			Stopwatch stopwatch(m_admissionNanoseconds);
+			if(!m_admission.admits(dataPacket.getName()))
+			{
+				++m_admissionRejectionsNum;
+				return;
+			}
+		}
+		while(m_remainderCapacity < dataPacket.getSize())
+		{
+			DataPacket tempDataPacket = evict();
+			m_remainderCapacity += tempDataPacket.getSize();
+			if(responsePacketNum > 400000)
+				reuseTime << tempDataPacket.getReuseTime() << endl;
+		}
+		insert(dataPacket, atFront);
+		m_remainderCapacity -= dataPacket.getSize();
+	}
+
+	/**
+	<@function. getStat
+	<@brief. Retrieve the statics for the Data packets in the content store, i.e., how many chunks of every file it holds. It takes
+		O(k log k) time for the k files it holds chunks of, as they are sorted, so that the snapshot does not depend on the order
+		of the hash table the files are kept in.
+	<@param. stat, a reference variable, the Data packet statistics will be stored in it, in increasing order of the file IDs.
+		It may be reused from snapshot to snapshot, so that taking one allocates nothing.
+	*/
+	void getStat(vector<ContentStoreStat>& stat) const
+	{
+		m_chunks.getStat(stat);
+	}
+
+	/**
+	<@function. getCachedChunksNum
+	<@brief. Get the number of chunks of a file in the content store.
+	*/
+	int getCachedChunksNum(int fileId) const
+	{
+		return m_chunks.getChunksNum(fileId);
+	}
+
+	/**
+	<@function. empty
+	<@brief. Check if the content store is empty. If the content store is empty, the function returns true. 
+		Otherwise the function returns false.
+	*/
+	bool empty()
+	{
+		return 0 == m_chunks.size();
+	}
+	
+	/**
+	<@function. getSize
+	<@bref. Get the number of Data packets in the content store.
+	*/
+	int getSize() const
+	{
+		return m_chunks.size();
+	}
+
+	/**
+	<@function. getHitsNum
+	<@brief. Get the number of lookups of the content store that found the Data packet.
+	*/
+	long long getHitsNum() const
+	{
+		return m_hitsNum;
+	}
+
+	/**
+	<@function. getMissesNum
+	<@brief. Get the number of lookups of the content store that did not find the Data packet.
+	*/
+	long long getMissesNum() const
+	{
+		return m_missesNum;
+	}
+
+	/**
+	<@function. getEvictionsNum
+	<@brief. Get the number of Data packets evicted from the content store.
+	*/
+	long long getEvictionsNum() const
+	{
+		return m_evictionsNum;
+	}
+
+	/**
+	<@function. getPolicyNanoseconds
+	<@brief. Get the time the replacement policy has taken, in nanoseconds, if replacementPolicyTiming is set, or 0.
+	*/
+	long long getPolicyNanoseconds() const
+	{
+		return m_policyNanoseconds;
+	}
+
+	/**
+	<@function. getAdmissionCandidatesNum
+	<@brief. Get the number of Data packets cached on the path that had to pass the admission filter, i.e., that would have displaced
+		cached ones, if the admission filter is enabled.
+	*/
+	long long getAdmissionCandidatesNum() const
+	{
+		return m_admissionCandidatesNum;
+	}
+
+	/**
+	<@function. getAdmissionRejectionsNum
+	<@brief. Get the number of Data packets the admission filter has rejected.
+	*/
+	long long getAdmissionRejectionsNum() const
+	{
+		return m_admissionRejectionsNum;
+	}
+
+	/**
+	<@function. getAdmissionNanoseconds
+	<@brief. Get the time the admission filter has taken, recording the requests and deciding, in nanoseconds, if replacementPolicyTiming
+		is set, or 0.
+	*/
+	long long getAdmissionNanoseconds() const
+	{
+		return m_admissionNanoseconds;
+	}
+	
+	/**
+	<@function. print
+	<@brief. Print out the status of the router.
+	*/
+	void print()
+	{
+		cout << "Content Store:" << endl;
+		cout << "capacity: " << m_capacity << endl;
+		cout << "remaider capacity: " << m_remainderCapacity << endl;
+		cout << "Data packets:" << endl;
+		for(int slot = m_policy->first(); -1 != slot; slot = m_policy->next(slot))
+			cout << m_slotNames[slot] << endl;
+	}
+
+	/**
+	<@function. printReuseTime
+	<@brief. Print the reuse time of all the Data packets in the content store.
+	*/
+	void printReuseTime() const
+	{
+		for(int slot = m_policy->first(); -1 != slot; slot = m_policy->next(slot))
+			reuseTime << m_chunks.getReuseTime(m_slotNames[slot]) << endl;
+	}
+
+	/**
+	<@function. countDataPackets
+	<@brief. In the function, the Data packets in the content store will be inserted into the given 
+		container, while the duplicate Data packets against the existing Data packets will be removed. Thus the container could count 
+		the number of unique Data packet there are.
+	<@param. containter, the Data packets in the content store will	be inserted into the container, and as the container is a
+		set, the duplicate Data packets will be removed automatically.
+	*/
+	void countDataPackets(set<DataPacket>& container)
+	{
+		for(int slot = m_policy->first(); -1 != slot; slot = m_policy->next(slot))
+			container.insert(m_chunks.get(m_slotNames[slot]));
+	}
+
+	private:
+	/**
+	<@brief. Adds the time from its construction to its destruction to a time in nanoseconds, e.g., the time the replacement policy
+		has taken, if replacementPolicyTiming is set.
+	*/
+	class Stopwatch
+	{
+		public:
+		Stopwatch(long long& nanoseconds) : m_nanoseconds(nanoseconds)
+		{
+			if(replacementPolicyTiming)
+				m_start = chrono::steady_clock::now();
+		}
+
+		~Stopwatch()
+		{
+			if(replacementPolicyTiming)
+				m_nanoseconds += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - m_start).count();
+		}
+
+		private:
+		long long& m_nanoseconds;
+		chrono::steady_clock::time_point m_start;
+	};
+
+	void init(long long capacity)
+	{
+		m_capacity = capacity;
+		m_remainderCapacity = capacity;
+		m_chunks = ChunkStore();
+		m_slotNames = vector<Name>();
+		m_freeSlots = vector<int>();
+		m_policy.reset(createReplacementPolicy(replacementPolicyType));
+		m_policy->setCapacity(getCapacityInDataPackets());
+		m_hitsNum = 0;
+		m_missesNum = 0;
+		m_evictionsNum = 0;
+		m_policyNanoseconds = 0;
+		m_admission = AdmissionFilter();
+		m_admissionEnabled = false;
+		m_admissionCandidatesNum = 0;
+		m_admissionRejectionsNum = 0;
+		m_admissionNanoseconds = 0;
+	}
+
+	/**
+	<@function. getCapacityInDataPackets
+	<@brief. Get the number of Data packets the content store holds when it is full, which the producers give the same size, and at
+		least 1, for the replacement policy.
+	*/
+	int getCapacityInDataPackets() const
+	{
+		return (int)max(1LL, m_capacity/DataPacket::defaultSize);
+	}
+
+	/**
+	<@function. findSlot
+	<@brief. Look up the slot holding the Data packet with the given name, or -1 if there is no such Data packet.
+	*/
+	int findSlot(const Name& name) const
+	{
+		return m_chunks.find(name);
+	}
+
+	/**
+	<@function. insert
+	<@brief. Put a Data packet into a free slot and hand the slot to the replacement policy. There must be no Data packet with the same name in the content store.
+	*/
+	void insert(const DataPacket& dataPacket, bool atFront)
+	{
+		int slot;
+		if(!m_freeSlots.empty())
+		{
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+			m_slotNames[slot] = dataPacket.getName();
+		}
+		else
+		{
+			slot = m_slotNames.size();
+			m_slotNames.push_back(dataPacket.getName());
+		}
+		m_chunks.insert(dataPacket, slot);
+		Stopwatch stopwatch(m_policyNanoseconds);
+		m_policy->insert(slot, dataPacket.getName(), atFront);
+	}
+
+	/**
+	<@function. evict
+	<@brief. Take the Data packet the replacement policy chooses out of the content store, which must not be empty, and free its slot.
+	<@return. The evicted Data packet.
+	*/
+	DataPacket evict()
+	{
+		int slot;
+		{
+			Stopwatch stopwatch(m_policyNanoseconds);
+			slot = m_policy->victim();
+			m_policy->erase(slot, m_slotNames[slot]);
+		}
+		DataPacket dataPacket = m_chunks.take(m_slotNames[slot]);
+		m_slotNames[slot] = Name();
+		m_freeSlots.push_back(slot);
+		++m_evictionsNum;
+		return dataPacket;
+	}
+
+	long long m_capacity;	//<@brief The size of the content store 
+	ChunkStore m_chunks;	//<@brief The Data packets, kept by file, each with the slot it takes.
+	vector<Name> m_slotNames;	//<@brief The name of the Data packet in every slot the replacement policy orders.
+	vector<int> m_freeSlots;	//<@brief The slots freed by evictions, reused first.
+	unique_ptr<ReplacementPolicy> m_policy;	//<@brief The replacement policy, which chooses the Data packets to be evicted.
+	long long m_remainderCapacity;	//<@brief The remaider capacity of the content store that could be used to store the Data packets
+	long long m_hitsNum;	//<@brief The number of lookups that found the Data packet.
+	long long m_missesNum;	//<@brief The number of lookups that did not find the Data packet.
+	long long m_evictionsNum;	//<@brief The number of Data packets evicted.
+	long long m_policyNanoseconds;	//<@brief The time the replacement policy has taken, if replacementPolicyTiming is set.
+	AdmissionFilter m_admission;	//<@brief The admission filter of the Data packets cached on the path, if it is enabled.
+	bool m_admissionEnabled;	//<@brief Whether the admission filter is enabled, see enableAdmission.
+	long long m_admissionCandidatesNum;	//<@brief The number of Data packets that had to pass the admission filter.
+	long long m_admissionRejectionsNum;	//<@brief The number of Data packets the admission filter rejected.
+	long long m_admissionNanoseconds;	//<@brief The time the admission filter has taken, if replacementPolicyTiming is set.
+};
+
+#endif
@@ -7,23 +7,30 @@
 #include <string>
 #include <algorithm>
 #include <list>
+#include <vector>
+#include <memory>
 
 #include "components.h"
+#include "NameTable.h"
 using namespace std;
+
+// A Data packet is copied once for every downstream face it is forwarded to, and moved everywhere else. Its name is interned
+// in the name table, and the parts of variable size, i.e., the payload and the relevant router list, are shared by the copies
+// until one of them modifies its own, so copying a Data packet never copies them.
 class DataPacket
 {
 	public:
 	enum Type{normal, nack, nocache, unknow};
 	DataPacket() :
-		m_name (""),
-		m_payload (""),
+		m_name (Name()),
+		m_payload (),
 		m_currentRouterDist (0),
 		m_cachingRouterDist (0),
 		m_size (0),
 		m_arrivalFace(-1),
 		m_type(unknow),
 		m_hopCount(0),
-		m_relevantRouters(list<FaceMetric>()),
+		m_relevantRouters(),
 		m_cachingRouterId(-1),
 		m_weight(0),
 		m_reuseTime(0),
@@ -31,16 +38,16 @@ class DataPacket
 	{
 	}
 	
-	DataPacket(string name) :
+	DataPacket(const Name& name) :
 		m_name(name),
-		m_payload (""),
+		m_payload (),
 		m_currentRouterDist (0),
 		m_cachingRouterDist (0),
-		m_size (name.size()),
+		m_size (nameTable.getNameLength(name)),
 		m_arrivalFace(-1),
 		m_type(unknow),
 		m_hopCount(0),
-		m_relevantRouters(list<FaceMetric>()),
+		m_relevantRouters(),
 		m_cachingRouterId(-1),
 		m_weight(0),
 		m_reuseTime(0),
@@ -48,16 +55,16 @@ class DataPacket
 	{
 	}	
 	
-	DataPacket(string name, string payload) :
+	DataPacket(const Name& name, string payload) :
 		m_name(name),
-		m_payload(payload),
+		m_payload(payload.empty() ? shared_ptr<const string>() : make_shared<const string>(payload)),
 		m_currentRouterDist(0),
 		m_cachingRouterDist(0),
-		m_size(name.size() + payload.size()),
+		m_size(nameTable.getNameLength(name) + payload.size()),
 		m_arrivalFace(-1),
 		m_type(normal),
 		m_hopCount(0),
-		m_relevantRouters(list<FaceMetric>()),
+		m_relevantRouters(),
 		m_cachingRouterId(-1),
 		m_weight(0),
 		m_reuseTime(0),
@@ -65,36 +72,22 @@ class DataPacket
 	{
 	}
 	
-	DataPacket(const DataPacket& other)
-	{
-		m_name = other.m_name;
-		m_currentRouterDist = other.m_currentRouterDist;
-		m_cachingRouterDist = other.getCachingRouterDist();
-		m_payload = other.m_payload;
-		m_size = other.m_size;
-		m_arrivalFace = other.m_arrivalFace;
-		m_type = other.m_type;
-		m_hopCount = other.m_hopCount;
-		m_relevantRouters = list<FaceMetric>();
-		other.getRelevantRouters(m_relevantRouters);
-		m_cachingRouterId = other.m_cachingRouterId;
-		m_weight = other.m_weight;
-		m_reuseTime = other.m_reuseTime;
-		m_id = other.m_id;
-	}
+	DataPacket(const DataPacket& other) = default;
+	DataPacket(DataPacket&& other) = default;
+	DataPacket& operator=(const DataPacket& other) = default;
+	DataPacket& operator=(DataPacket&& other) = default;
 	
 	/**
 	<@brief Set the name of the Data packet. Its name will be set by the way.
 	*/
-	void setName(string name)
+	void setName(const Name& name)
 	{
-		if("" != m_name)
-			m_size -= m_name.size();
+		m_size -= nameTable.getNameLength(m_name);
 		m_name = name;
-		m_size += name.size();
+		m_size += nameTable.getNameLength(name);
 	}
 	
-	string getName() const
+	const Name& getName() const
 	{
 		return m_name;
 	}
@@ -142,17 +135,17 @@ class DataPacket
 	/**
 	<@brief Set the payload of the Data packet. Its size will be set.
 	*/
-	void setPayload(string payload)
+	void setPayload(const string& payload)
 	{
-		if("" != m_payload)
-			m_size -= m_payload.size();
-		m_payload = payload;
-		m_size += m_payload.size();
+		if(m_payload)
+			m_size -= m_payload->size();
+		m_payload = payload.empty() ? shared_ptr<const string>() : make_shared<const string>(payload);
+		m_size += payload.size();
 	}
 	
 	string getPayload() const
 	{
-		return m_payload;
+		return m_payload ? *m_payload : string();
 	}
 	
 	void setArrivalFace(int arrivalFace)
@@ -168,7 +161,17 @@ class DataPacket
 	void setSize()
 	{
 		//m_size = m_payload.length() + m_name.length();
-		m_size = 1024;
+		m_size = defaultSize;
+	}
+
+	static const int defaultSize = 1024;	//<@brief. The size the producers give every Data packet, see setSize.
+	
+	/**
+	<@brief. Set the size of the Data packet, e.g., the size it was cached with.
+	*/
+	void setSize(string::size_type size)
+	{
+		m_size = size;
 	}
 	
 	string::size_type getSize() const
@@ -231,24 +234,6 @@ class DataPacket
 		m_weight -= value;
 	}
 	
-	void operator=(const DataPacket& other)
-	{
-		m_name = other.m_name;
-		m_currentRouterDist = other.m_currentRouterDist;
-		m_cachingRouterDist = other.getCachingRouterDist();
-		m_payload = other.m_payload;
-		m_size = other.m_size;
-		m_arrivalFace = other.m_arrivalFace;
-		m_type = other.m_type;
-		m_hopCount = other.m_hopCount;
-		m_relevantRouters = list<FaceMetric>();
-		other.getRelevantRouters(m_relevantRouters);
-		m_cachingRouterId = other.m_cachingRouterId;
-		m_weight = other.m_weight;
-		m_reuseTime = other.m_reuseTime;
-		m_id = other.m_id;
-	}
-	
 	bool operator==(const DataPacket& other) const
 	{
 		return m_name == other.getName();
@@ -261,16 +246,12 @@ class DataPacket
 	
 	/**
 	<@function. getRelevantRouters
-	<@brief. Pass a reference variable and store all the data in the node's relevant router list into the variable. Then other function will 
-		be able to retrive the the datas through the reference variable.
-	<@param. relevantRouters, the reference variable to be passed to the function.
+	<@brief. Get the routers which maintain dynamic routing information for the Data packet.
 	*/
-	void getRelevantRouters(list<FaceMetric>& relevantRouters) const
+	const vector<FaceMetric>& getRelevantRouters() const
 	{
-		relevantRouters.clear();
-		for(list<FaceMetric>::const_iterator iter(m_relevantRouters.begin()), end(m_relevantRouters.end());
-			iter != end; ++iter)
-			relevantRouters.push_back(*iter);
+		static const vector<FaceMetric> noRelevantRouters;
+		return m_relevantRouters ? *m_relevantRouters : noRelevantRouters;
 	}
 
 	/**
@@ -280,15 +261,15 @@ class DataPacket
 	<@param. face, the face associated with the dynamic FIB entry corresponding to the FaceMetric information.
 	<@param. metric, the distance from the router where the Data packet will be cached to the current router.
 	*/
-	void insertRelevantRouter(int router, vector<int> faces, float metric)
+	void insertRelevantRouter(int router, const vector<int>& faces, float metric)
 	{
 		FaceMetric faceMetric;
 		faceMetric.router = router;
 		faceMetric.faces = faces;
 		faceMetric.metric = metric;
-		list<FaceMetric>::iterator iter = find(m_relevantRouters.begin(), m_relevantRouters.end(), faceMetric);
-		if(m_relevantRouters.end() == iter)
-			m_relevantRouters.push_back(faceMetric);
+		const vector<FaceMetric>& relevantRouters = getRelevantRouters();
+		if(relevantRouters.end() == find(relevantRouters.begin(), relevantRouters.end(), faceMetric))
+			modifyRelevantRouters().push_back(faceMetric);
 	}
 	
 	/**
@@ -296,21 +277,41 @@ class DataPacket
 	<@brief. Add a list of FaceMetric in to the relevantRouters list.
 	<@param. relevantRouters, a list of FaceMetric.
 	*/
-	void addRelevantRouters(list<FaceMetric> relevantRouters)
+	void addRelevantRouters(const vector<FaceMetric>& relevantRouters)
 	{
-		for(list<FaceMetric>::iterator iter(relevantRouters.begin()), end(relevantRouters.end());
-			iter != end; ++iter)
-			m_relevantRouters.push_back(*iter);
+		if(relevantRouters.empty())
+			return;
+		vector<FaceMetric>& ownRelevantRouters = modifyRelevantRouters();
+		ownRelevantRouters.insert(ownRelevantRouters.end(), relevantRouters.begin(), relevantRouters.end());
 	}
 
 
+	/**
+	<@function. shareRelevantRouters
+	<@brief. Get the relevant router list of the Data packet to share it, e.g., with a content store, or null if it is empty. The list must
+		not be modified through the pointer; the Data packet and the other holders copy it before they modify it.
+	*/
+	shared_ptr<vector<FaceMetric> > shareRelevantRouters() const
+	{
+		return m_relevantRouters;
+	}
+
+	/**
+	<@function. setRelevantRouters
+	<@brief. Let the Data packet share a relevant router list, e.g., one kept by a content store, or null for an empty list.
+	*/
+	void setRelevantRouters(const shared_ptr<vector<FaceMetric> >& relevantRouters)
+	{
+		m_relevantRouters = relevantRouters;
+	}
+
 	/**
 	<@function. clearRelevantRouter
 	<@brief. Clear the relevant router list of the Data packet.
 	*/
 	void clearRelevantRouters()
 	{
-		m_relevantRouters.clear();
+		m_relevantRouters.reset();
 	}
 	
 	void setCachingRouterId(int cachingRouterId)
@@ -363,35 +364,50 @@ class DataPacket
 		cout << "name: " << m_name << endl;
 		cout << "current router dist: " << m_currentRouterDist << endl;
 		cout << "caching router dist: " << m_cachingRouterDist << endl;
-		cout << "payload: " << m_payload << endl;
+		cout << "payload: " << getPayload() << endl;
 		cout << "size: " << m_size << endl;
 		cout << "arrival face: " << m_arrivalFace << endl;
 		cout << "type: ";
 		if(normal == m_type) cout << "normal" << endl;
 		else if(nack == m_type) cout << "nack" << endl;
 		cout << "relevant routers:" << endl;
-		for(list<FaceMetric>::iterator iter(m_relevantRouters.begin()), end(m_relevantRouters.end());
+		vector<FaceMetric> relevantRouters(getRelevantRouters());
+		for(vector<FaceMetric>::iterator iter(relevantRouters.begin()), end(relevantRouters.end());
 			iter != end; ++iter)
 			iter->print();
 		cout << "----------" << endl;
 	}
 
 	private:
-	string m_name;	//<@brief The name of the Data packet.
+	/**
+	<@function. modifyRelevantRouters
+	<@brief. Get the relevant router list of the Data packet to modify it, after copying it if it is shared with other copies of
+		the Data packet.
+	*/
+	vector<FaceMetric>& modifyRelevantRouters()
+	{
+		if(!m_relevantRouters)
+			m_relevantRouters = make_shared<vector<FaceMetric> >();
+		else if(1 != m_relevantRouters.use_count())
+			m_relevantRouters = make_shared<vector<FaceMetric> >(*m_relevantRouters);
+		return *m_relevantRouters;
+	}
+
+	Name m_name;	//<@brief The interned name of the Data packet.
 	int m_currentRouterDist;	//<@brief The distance from the end user to the current router.
 	int m_cachingRouterDist;	//<@brief The distance from the end user to the caching router.
-	string m_payload;	//<@brief The payload of the Data packet.
-	string::size_type m_size;	//<@brief The size of the Data packet. It's the sum of the payload's size and the name's size.
+	shared_ptr<const string> m_payload;	//<@brief The payload of the Data packet, shared by its copies, or null if it is empty.
+	string::size_type m_size;	//<@brief The size of the Data packet. It's the sum of the payload's size and the size of the name's string form.
 	int m_arrivalFace;	//<@brief. //<@brief. The arrival face of the Data packet. In the framework, 
 	// we take a node's ID as the face corresponding to it. So when node A forwards the Data packet to another node, say node B, 
 	// node A will set the arrival face of the Data packet as its own ID.
 	Type m_type;	//<@brief. The type of the Data packet. When it is a normal Data packet, its type is normal, and when it is a
 	// NACK packet, its type is nack.
 	int m_hopCount;	//<@brief. The total hops the Data packet and the Interest packet requesting it have travels.
-	list<FaceMetric> m_relevantRouters;	//<@brief. The list record the routers which maintains dynamic routing information for the Data packet.
+	shared_ptr<vector<FaceMetric> > m_relevantRouters;	//<@brief. The list record the routers which maintains dynamic routing information for the Data packet.
 		// When the Data packet is evicted, all the dynamic routing information about the packet will be updated. The mechanism is 
 		// is hard to implement in real network. We do this to implement our frame work in a perfect condition where the dynamic routing information
-		// is updated in time.
+		// is updated in time. It is shared by the copies of the Data packet until one of them modifies it, and null if it is empty.
 	int m_cachingRouterId;	//The id of the router the Data packet will be cached.
 	float m_weight;	//<@brief. The member is used to measuer how important the Data packet is; the metric will be used when 
 	// some Data packet need to be evicted from the content store in our probabilitic eviction version of the routing framework.
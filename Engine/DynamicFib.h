@@ -0,0 +1,283 @@
+// DynamicFib.h
+// The dynamic FIB is an open addressing hash table keyed by file ID, with linear probing and backward shift deletion.
+// The entries live in the slots of the table and keep their face infos in a vector sorted by face, so routing updates
+// modify the entries in place and the forwarding query reads the face infos through a view without copying them.
+// When fibFaceExpiry is set, every renewal of a face also drops a record into a timing wheel, in the bucket of its expiry
+// time. The lifetime of every renewed face is fibFaceLifetime, so a wheel of fibFaceLifetime + 1 buckets never wraps
+// around, and a tick only visits the buckets of the elapsed time. Records left behind by faces renewed since are skipped.
+#ifndef DYNAMIC_FIB_H
+#define DYNAMIC_FIB_H
+
+//#include <vld.h>
+
+#include <set>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "DynamicFibEntry.h"
+#include "FaceInfo.h"
+#include "components.h"
+using namespace std;
+
+extern int fibFaceLifetime;
+extern bool fibFaceExpiry;
+
+class DynamicFib
+{
+	public:
+	DynamicFib()
+	{
+		m_slots = vector<DynamicFibEntry>();
+		m_size = 0;
+		m_now = 0;
+		m_expiryWheel = vector<vector<FaceExpiry> >();
+	}
+
+	~DynamicFib()
+	{
+	}
+
+	/**
+	<@function. addRoutingInfo
+	<@brief. This happens when we need to establish routing information for a Data packet.
+			If there is no dynamic FIB entry for the given file, we will install a new entry for it.
+			If there is a entry for the file, the relevant information about the entry will be updated.
+	<@param. fileId, the file for which we need to establish routing information.
+	<@param. metric, the distance from the caching router to the current router.
+	<@param. faces, the face list associated with the routing information.
+	*/
+	void addRoutingInfo(int fileId, const vector<int>& faces, float metric)
+	{
+		int expiryTime = m_now + fibFaceLifetime;
+		m_slots[findOrInsertSlot(fileId)].addRoutingInfo(faces, metric, expiryTime);
+		scheduleExpiry(fileId, faces, expiryTime);
+	}
+
+	/**
+	<@function. eraseRoutingInfo
+	<@brief. That the function is called means a Data packet for which the dynamic FIB maintains routing information has been dropped,
+		so we need to update the relevant routing information in the dynamic FIB.
+	<@param. fileId, the file the dropped Data packet belongs to.
+	<@param. face, the ID of  router in which the dropped Data packet is located.
+	<@param. metric, the distance from the router in which the dropped Data packet is located to the this router.
+	*/
+	void eraseRoutingInfo(int fileId, const vector<int>& faces, float metric)
+	{
+		int slot = findSlot(fileId);
+		if(-1 == slot)
+			return;	// No relevat dynamic FIB entry exists in the router.
+		int expiryTime = m_now + fibFaceLifetime;
+		m_slots[slot].eraseRoutingInfo(faces, metric, expiryTime);
+		if(0 == m_slots[slot].getFacesNum())
+			eraseSlot(slot);
+		else scheduleExpiry(fileId, faces, expiryTime);
+	}
+
+	/**
+	<@function. timeElapse
+	<@brief. As a span of time elapse, the lifetime of the FIB entries will be updated. The timed-out faces will be removed from their
+				home FIB entries. The FIB entries with no faces will be dropped from the FIB.
+				The cost is proportional to the number of faces renewed during the elapsed time, not to the size of the FIB.
+	<@param. deviation, the amount of elapsed time.
+	<@attention. Faces expire only if fibFaceExpiry was set when they were renewed.
+	*/
+	void timeElapse(int deviation)
+	{
+		int now = m_now + deviation;
+		int wheelSize = m_expiryWheel.size();
+		for(int time = m_now; time < now && time < m_now + wheelSize; ++time)
+		{
+			vector<FaceExpiry>& bucket = m_expiryWheel[time % wheelSize];
+			for(vector<FaceExpiry>::iterator iter(bucket.begin()), end(bucket.end());
+				iter != end; ++iter)
+			{
+				int slot = findSlot(iter->fileId);
+				if(-1 == slot)
+					continue;	// The entry has been dropped since.
+				m_slots[slot].expireFace(iter->face, iter->expiryTime);
+				if(0 == m_slots[slot].getFacesNum())
+					eraseSlot(slot);
+			}
+			bucket.clear();
+		}
+		m_now = now;
+	}
+
+	/**
+	<@function. matchingEntryExists
+	<@brief. Check if there is a FIB entry matching the given file.
+	<@param. fileId, the file to be checked against.
+	<@return. Return true if a matching entry exist, return false otherwise.
+	*/
+	bool matchingEntryExists(int fileId) const
+	{
+		return -1 != findSlot(fileId);
+	}
+
+	/**
+	<@function. getMatchingFaceInfos
+	<@brief. Get the face infos in the matching entry, if any.
+	<@param. fileId, the destination file whose relevant face infos are to be extracted.
+	<@return. A read-only view of the face infos in the matching FIB entry, in increasing order of faces.
+			If there is no matching FIB entry or the face list in the FIB entry is empty, the view is empty.
+	*/
+	FaceInfoView getMatchingFaceInfos(int fileId) const
+	{
+		int slot = findSlot(fileId);
+		if(-1 == slot)
+			return FaceInfoView();
+		return m_slots[slot].getFaceInfos();
+	}
+
+	/**
+	<@function. print
+	<@brief. Print the content of the FIB, with the entries in the order of their files.
+	*/
+	void print() const
+	{
+		cout << "dynamic FIB:" << endl;
+		vector<pair<int, int> > entries;
+		for(int i = 0; i < (int)m_slots.size(); ++i)
+		{
+			if(!m_slots[i].isEmpty())
+				entries.push_back(make_pair(m_slots[i].getFileId(), i));
+		}
+		sort(entries.begin(), entries.end());
+		for(vector<pair<int, int> >::iterator iter(entries.begin()), end(entries.end());
+			iter != end; ++iter)
+			m_slots[iter->second].print();
+	}
+
+	/**
+	<@function. getSize
+	<@brief. Get the number of FIB entries in the dynamic FIB.
+	*/
+	int getSize() const
+	{
+		return m_size;
+	}
+
+	/**
+	<@function. getEntry
+	<@brief. Given a file, the function will return the dynamic FIB entry corresponding to it.
+	<@param. fileId, the file for which we will retrieve the dynamic FIB entry.
+	<@param. entry, a reference variable, the returned dynamic FIB entry will be stored in it.
+	*/
+	void getEntry(int fileId, DynamicFibEntry& entry) const
+	{
+		int slot = findSlot(fileId);
+		if(-1 == slot)
+			entry.reset(-1);
+		else entry = m_slots[slot];
+	}
+
+	private:
+	/**
+	<@function. scheduleExpiry
+	<@brief. Record in the timing wheel that the given faces of a file expire at the given time.
+	*/
+	void scheduleExpiry(int fileId, const vector<int>& faces, int expiryTime)
+	{
+		if(!fibFaceExpiry)
+			return;
+		if(m_expiryWheel.empty())
+			m_expiryWheel = vector<vector<FaceExpiry> >(fibFaceLifetime + 1);
+		vector<FaceExpiry>& bucket = m_expiryWheel[expiryTime % m_expiryWheel.size()];
+		FaceExpiry faceExpiry;
+		faceExpiry.fileId = fileId;
+		faceExpiry.expiryTime = expiryTime;
+		for(vector<int>::const_iterator iter(faces.begin()), end(faces.end());
+			iter != end; ++iter)
+		{
+			faceExpiry.face = *iter;
+			bucket.push_back(faceExpiry);
+		}
+	}
+
+	int getHomeSlot(int fileId) const
+	{
+		return NameHash()(Name(fileId, 0)) & (m_slots.size() - 1);
+	}
+
+	/**
+	<@function. findSlot
+	<@return. The slot holding the entry of the given file, or -1 if there is no such entry.
+	*/
+	int findSlot(int fileId) const
+	{
+		if(0 == m_size)
+			return -1;
+		int mask = m_slots.size() - 1;
+		for(int slot = getHomeSlot(fileId); !m_slots[slot].isEmpty(); slot = (slot + 1) & mask)
+		{
+			if(m_slots[slot].getFileId() == fileId)
+				return slot;
+		}
+		return -1;
+	}
+
+	/**
+	<@function. findOrInsertSlot
+	<@return. The slot holding the entry of the given file. If there is no such entry, an entry without any face is created.
+	*/
+	int findOrInsertSlot(int fileId)
+	{
+		if(4*(m_size + 1) > 3*(int)m_slots.size())
+			rehash(m_slots.empty() ? 8 : 2*m_slots.size());
+		int mask = m_slots.size() - 1;
+		int slot = getHomeSlot(fileId);
+		for(; !m_slots[slot].isEmpty(); slot = (slot + 1) & mask)
+		{
+			if(m_slots[slot].getFileId() == fileId)
+				return slot;
+		}
+		m_slots[slot].reset(fileId);
+		++m_size;
+		return slot;
+	}
+
+	/**
+	<@function. eraseSlot
+	<@brief. Empty a slot, then move back the entries following it that would otherwise become unreachable.
+	*/
+	void eraseSlot(int slot)
+	{
+		int mask = m_slots.size() - 1;
+		m_slots[slot].reset(-1);
+		--m_size;
+		for(int next = (slot + 1) & mask; !m_slots[next].isEmpty(); next = (next + 1) & mask)
+		{
+			int home = getHomeSlot(m_slots[next].getFileId());
+			// The entry stays if its home slot lies cyclically in (slot, next].
+			if(slot <= next ? (slot < home && home <= next) : (slot < home || home <= next))
+				continue;
+			m_slots[slot].swap(m_slots[next]);
+			slot = next;
+		}
+	}
+
+	void rehash(int slotsNum)
+	{
+		vector<DynamicFibEntry> oldSlots(slotsNum);
+		m_slots.swap(oldSlots);
+		int mask = slotsNum - 1;
+		for(vector<DynamicFibEntry>::iterator iter(oldSlots.begin()), end(oldSlots.end());
+			iter != end; ++iter)
+		{
+			if(iter->isEmpty())
+				continue;
+			int slot = getHomeSlot(iter->getFileId());
+			while(!m_slots[slot].isEmpty())
+				slot = (slot + 1) & mask;
+			m_slots[slot].swap(*iter);
+		}
+	}
+
+	vector<DynamicFibEntry> m_slots;	//<@brief. The slots of the hash table, a slot with file ID -1 is empty. The number of slots is zero or a power of two.
+	int m_size;	//<@brief. The number of FIB entries.
+	int m_now;	//<@brief. The clock of the FIB, advanced by timeElapse.
+	vector<vector<FaceExpiry> > m_expiryWheel;	//<@brief. The timing wheel. The bucket t % m_expiryWheel.size() holds the faces expiring at time t.
+};
+
+#endif
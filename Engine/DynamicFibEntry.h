@@ -0,0 +1,272 @@
+// DynamicFibEntry.h
+#ifndef DYNAMIC_FIB_ENTRY_H
+#define DYNAMIC_FIB_ENTRY_H
+
+//#include <vld.h>
+
+#include <string>
+#include <set>
+#include <vector>
+#include <algorithm>
+
+#include "FaceInfo.h"
+#include "NameTable.h"
+using namespace std;
+
+/**
+<@brief. A read-only view of the face infos of a dynamic FIB entry, in increasing order of faces.
+	The view is invalidated by the next modification of the dynamic FIB.
+*/
+class FaceInfoView
+{
+	public:
+	typedef const FaceInfo* const_iterator;
+
+	FaceInfoView()
+	{
+		m_begin = 0;
+		m_end = 0;
+	}
+
+	FaceInfoView(const FaceInfo* begin, const FaceInfo* end)
+	{
+		m_begin = begin;
+		m_end = end;
+	}
+
+	const_iterator begin() const
+	{
+		return m_begin;
+	}
+
+	const_iterator end() const
+	{
+		return m_end;
+	}
+
+	int size() const
+	{
+		return m_end - m_begin;
+	}
+
+	bool empty() const
+	{
+		return m_begin == m_end;
+	}
+
+	private:
+	const FaceInfo* m_begin;
+	const FaceInfo* m_end;
+};
+
+class DynamicFibEntry
+{
+	public:
+	DynamicFibEntry(int fileId)
+	{
+		m_fileId = fileId;
+		m_faceInfos = vector<FaceInfo>();
+	}
+
+	DynamicFibEntry()
+	{
+		m_fileId = -1;
+		m_faceInfos = vector<FaceInfo>();
+	}
+
+	DynamicFibEntry(int fileId, const vector<int>& faces, float metric, int expiryTime)
+	{
+		m_fileId = fileId;
+		m_faceInfos = vector<FaceInfo>();
+		addRoutingInfo(faces, metric, expiryTime);
+	}
+
+	~DynamicFibEntry()
+	{
+	}
+
+	void setFileId(int fileId)
+	{
+		m_fileId = fileId;
+	}
+
+	int getFileId() const
+	{
+		return m_fileId;
+	}
+
+	bool isEmpty() const
+	{
+		return -1 == m_fileId;
+	}
+
+	/**
+	<@function. reset
+	<@brief. Turn the entry into an entry of the given file without any face. The memory of the face infos is kept for reuse.
+	*/
+	void reset(int fileId)
+	{
+		m_fileId = fileId;
+		m_faceInfos.clear();
+	}
+
+	/**
+	<@function. swap
+	<@brief. Exchange the contents of two entries without copying the face infos.
+	*/
+	void swap(DynamicFibEntry& other)
+	{
+		std::swap(m_fileId, other.m_fileId);
+		m_faceInfos.swap(other.m_faceInfos);
+	}
+
+	/**
+	<@function. expireFace
+	<@brief. Drop a face whose lifetime has run out.
+	<@param. face, the face to be dropped.
+	<@param. expiryTime, the expiry time the face was given when its lifetime was last renewed.
+	<@besides. If the lifetime of the face has been renewed since, its expiry time no longer matches and the face is kept.
+	*/
+	void expireFace(int face, int expiryTime)
+	{
+		vector<FaceInfo>::iterator iter = lower_bound(m_faceInfos.begin(), m_faceInfos.end(), FaceInfo(face));
+		if(m_faceInfos.end() != iter && face == iter->getFace() && expiryTime == iter->getExpiryTime())
+			m_faceInfos.erase(iter);
+	}
+
+	/**
+	<@function getFacesNum
+	<@brief Get the number of available faces
+	<@return The number of faces which could be used to forward Interest packet.
+	*/
+	int getFacesNum() const
+	{
+		return m_faceInfos.size();
+	}
+
+	/**
+	<@function. addRoutingInfo
+	<@brief. When the function is called, that means that we need to install dynamic routing information for a Data packet.
+			For the reasons of the operations here please refer our paper "'Do My Best' Routing in Named Data Networking".
+			For every relevant face, its expiry time will be updated to a given value,
+			its metric will be updated to a new value, and its value of num will be increased by 1.
+	<@param. faces, the faces need to be updated.
+	<@param. metric, the distance from caching router to current router.
+	<@param. expiryTime, the new expiry time of the faces.
+	*/
+	void addRoutingInfo(const std::vector<int>& faces, float metric, int expiryTime)
+	{
+		std::vector<int>::const_iterator iter(faces.begin()), end(faces.end());
+		for(; iter != end; ++iter)
+		{
+			FaceInfo faceInfo(*iter);
+			std::vector<FaceInfo>::iterator infoIter = lower_bound(m_faceInfos.begin(), m_faceInfos.end(), faceInfo);
+			if(m_faceInfos.end() == infoIter || *iter != infoIter->getFace())	//It's a new face, create a quadruple for it.
+			{
+				faceInfo.setMetric(metric);
+				faceInfo.setNum(1);
+				faceInfo.setExpiryTime(expiryTime);
+				m_faceInfos.insert(infoIter, faceInfo);
+			}
+			else //A quadruple corresponding to the face has existed, update the quadruple.
+			{
+				if(metric != infoIter->getMetric())
+				{
+					float newMetric = (infoIter->getMetric()*infoIter->getNum() + metric)/(infoIter->getNum() + 1);
+					infoIter->setMetric(newMetric);
+				}
+				infoIter->setNum(infoIter->getNum() + 1);
+				infoIter->setExpiryTime(expiryTime);
+			}
+		}
+	}
+
+	/**
+	<@function. eraseRoutingInfo
+	<@brief. When the function is called, it means a Data packet for which we have maintained dynamic routing information has
+		been dropped, so we need to update the dynamic FIB entry accordingly.
+	<@param. face, where the dropped Data packet is located.
+	<@param. metric, the distance from the router in which the dropped Data packet is located and the current router.
+	<@param. expiryTime, the new expiry time of the faces that are kept.
+	*/
+	void eraseRoutingInfo(const vector<int>& faces, float metric, int expiryTime)
+	{
+		for(vector<int>::const_iterator iter(faces.begin()), end(faces.end());
+			iter != end; ++iter)
+		{
+			vector<FaceInfo>::iterator iterFaceInfo = lower_bound(m_faceInfos.begin(), m_faceInfos.end(), FaceInfo(*iter));
+			if(m_faceInfos.end() == iterFaceInfo || *iter != iterFaceInfo->getFace())
+				continue;	// The corresponding face doesn't exist, do nothing.
+			if(1== iterFaceInfo->getNum())
+			{
+				m_faceInfos.erase(iterFaceInfo);
+			}
+			else
+			{
+				float newMetric = iterFaceInfo->getMetric()*iterFaceInfo->getNum()-metric;
+				newMetric = newMetric/(iterFaceInfo->getNum() - 1);
+				iterFaceInfo->setMetric(newMetric);
+				iterFaceInfo->setNum(iterFaceInfo->getNum() - 1);
+				iterFaceInfo->setExpiryTime(expiryTime);
+			}
+		}
+	}
+
+	/**
+	<@function. clearFaceInfos
+	<@brief. Clear the face infos stored in the dynamic FIB entry.
+	*/
+	void clearFaceInfos()
+	{
+		m_faceInfos.clear();
+	}
+
+	/**
+	<@function. dropFace
+	<@brief. Drop a face as well as its relevant information from the FIB entry.
+	<@param. face, the face to be dropped.
+	*/
+	void dropFace(int face)
+	{
+		vector<FaceInfo>::iterator iter = lower_bound(m_faceInfos.begin(), m_faceInfos.end(), FaceInfo(face));
+		if(m_faceInfos.end() != iter && face == iter->getFace())
+			m_faceInfos.erase(iter);
+	}
+
+	/**
+	<@function. getFaceInfos
+	<@brief. Get the face infos associated with the FIB entry, in increasing order of faces.
+	<@return. A read-only view of the face infos. It is empty if there is no face info.
+	*/
+	FaceInfoView getFaceInfos() const
+	{
+		if(m_faceInfos.empty())
+			return FaceInfoView();
+		return FaceInfoView(&m_faceInfos[0], &m_faceInfos[0] + m_faceInfos.size());
+	}
+
+	bool operator<(const DynamicFibEntry& other) const
+	{
+		return m_fileId < other.getFileId();
+	}
+
+	/**
+	<@function. print
+	<@brief. Print the content of the FIB entry.
+	*/
+	void print() const
+	{
+		if(-1 == m_fileId)
+			cout << "<none>" << endl;
+		else cout << nameTable.getFileName(m_fileId) << endl;
+		for(vector<FaceInfo>::const_iterator iter(m_faceInfos.begin()), end(m_faceInfos.end());
+			iter != end; ++iter)
+			iter->print();
+	}
+
+	private:
+	int m_fileId;	//<@brief The file, in the name table, the FIB entry is associated with, i.e., the name without its chunk number.
+	std::vector<FaceInfo> m_faceInfos;	//<@brief The relevant information of every face associated with the FIB entry, in increasing order of faces.
+};
+
+#endif
@@ -0,0 +1,156 @@
+// EgoBetweenness.h
+// The module computes the ego network betweenness centrality of the nodes, see Martin Everett and Stephen P. Borgatti's
+// "Ego network betweenness". The ego network of a node is the node and its neighbours, the alters. Every pair of alters that
+// are not connected contributes the reciprocal of the number of the nodes of the ego network connected to both, i.e., the
+// node itself and the alters connected to both. The alters a alter is connected to are kept as a row of bits, so the alters
+// connected to both of a pair are counted by the population count of the intersection of their rows, and a node of degree d
+// costs O(d*d*d/64) word operations and O(d*d) bits. The centralities of different nodes are independent, so they may be
+// computed in parallel.
+#ifndef EGO_BETWEENNESS_H
+#define EGO_BETWEENNESS_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <thread>
+
+#include "Graph.h"
+using namespace std;
+
+class EgoBetweenness
+{
+	public:
+	EgoBetweenness()
+	{
+		m_graph = NULL;
+		m_centralities = vector<float>();
+	}
+
+	/**
+	<@function. compute
+	<@brief. Compute the ego network betweenness centrality of the given nodes. Every centrality is summed up in the same order
+		whatever the number of threads, so the result does not depend on it.
+	<@param. graph, the adjacency of the network.
+	<@param. origins, the IDs of the nodes whose centralities are computed. The centralities of the other nodes are -1.
+	<@param. threadsNum, the number of threads among which the nodes are distributed.
+	*/
+	void compute(const Graph& graph, const vector<int>& origins, int threadsNum = 1)
+	{
+		m_graph = &graph;
+		m_origins = origins;
+		m_centralities = vector<float>(graph.getNodesNum(), -1);
+		int originsNum = origins.size();
+		if(threadsNum > originsNum)
+			threadsNum = originsNum;
+		if(threadsNum <= 1)
+		{
+			computeWorker(0, 1);
+			return;
+		}
+		vector<thread> workers;
+		for(int t = 0; t < threadsNum; ++t)
+			workers.push_back(thread(&EgoBetweenness::computeWorker, this, t, threadsNum));
+		for(vector<thread>::iterator iter(workers.begin()), end(workers.end());
+			iter != end; ++iter)
+			iter->join();
+	}
+
+	/**
+	<@function. getCentrality
+	<@brief. Get the ego network betweenness centrality of a node, or -1 if it has not been computed.
+	*/
+	float getCentrality(int node) const
+	{
+		return m_centralities[node];
+	}
+
+	/**
+	<@function. installCentralities
+	<@brief. Give every node the ego network betweenness centrality computed for it.
+	<@param. nodes, the nodes in the network.
+	*/
+	template<class NodeType>
+	void installCentralities(vector<NodeType>& nodes) const
+	{
+		for(vector<int>::const_iterator iter(m_origins.begin()), end(m_origins.end());
+			iter != end; ++iter)
+			nodes[*iter].setBetweennessCentrality(m_centralities[*iter]);
+	}
+
+	/**
+	<@function. computeCentrality
+	<@brief. Compute the ego network betweenness centrality of a single node.
+	<@param. graph, the adjacency of the network.
+	<@param. origin, the node for which we will compute the ego network centrality betweenness.
+	<@param. alterPositions, a reference variable of graph.getNodesNum() elements, all -1. The position of every alter among the
+		alters of the node is kept in it during the computation, and it is all -1 again afterwards.
+	<@param. rows, a reference variable, the rows of bits of the alters are kept in it.
+	*/
+	static float computeCentrality(const Graph& graph, int origin, vector<int>& alterPositions, vector<unsigned long long>& rows)
+	{
+		const int* alters = graph.getNeighbours(origin);
+		int altersNum = graph.getDegree(origin);
+		int wordsNum = (altersNum + 63)/64;
+		for(int i = 0; i < altersNum; ++i)
+			alterPositions[alters[i]] = i;
+		rows.assign((size_t)altersNum*wordsNum, 0);
+		for(int i = 0; i < altersNum; ++i)
+		{
+			unsigned long long* row = &rows[(size_t)i*wordsNum];
+			const int* neighbours = graph.getNeighbours(alters[i]);
+			for(int k = 0; k < graph.getDegree(alters[i]); ++k)
+			{
+				int position = alterPositions[neighbours[k]];
+				if(-1 != position)
+					row[position >> 6] |= 1ULL << (position & 63);
+			}
+		}
+		for(int i = 0; i < altersNum; ++i)
+			alterPositions[alters[i]] = -1;
+
+		float ret = 0;
+		for(int i = 0; i < altersNum; ++i)
+		{
+			const unsigned long long* row1 = &rows[(size_t)i*wordsNum];
+			for(int j = i + 1; j < altersNum; ++j)
+			{
+				if(row1[j >> 6] & (1ULL << (j & 63)))
+					continue;	// The alters are connected.
+				const unsigned long long* row2 = &rows[(size_t)j*wordsNum];
+				int pathsNum = 1;	// The path through the node itself.
+				for(int w = 0; w < wordsNum; ++w)
+					pathsNum += countBits(row1[w] & row2[w]);
+				ret +=  1/float(pathsNum);
+			}
+		}
+		return ret;
+	}
+
+	private:
+	void computeWorker(int first, int step)
+	{
+		vector<int> alterPositions(m_graph->getNodesNum(), -1);
+		vector<unsigned long long> rows;
+		int originsNum = m_origins.size();
+		for(int i = first; i < originsNum; i += step)
+			m_centralities[m_origins[i]] = computeCentrality(*m_graph, m_origins[i], alterPositions, rows);
+	}
+
+	static int countBits(unsigned long long word)
+	{
+#if defined(__GNUC__)
+		return __builtin_popcountll(word);
+#else
+		int count = 0;
+		for(; 0 != word; word &= word - 1)
+			++count;
+		return count;
+#endif
+	}
+
+	const Graph* m_graph;	//<@brief. The adjacency of the network.
+	vector<int> m_origins;	//<@brief. The nodes whose centralities are computed.
+	vector<float> m_centralities;	//<@brief. The ego network betweenness centrality of every node, -1 if it has not been computed.
+};
+
+#endif
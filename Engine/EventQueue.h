@@ -0,0 +1,207 @@
+// EventQueue.h
+// The event queue gives the simulation an explicit clock. Time advances in ticks, one tick per round of the main loop, and
+// sending a packet over a link takes the processing delay of the sending node plus the delay of the link. A packet sent
+// with a positive delay becomes an arrival event, kept in a calendar queue with one bucket per tick. The number of buckets
+// is a power of two larger than the longest delay, so an event is scheduled and delivered in constant time and the calendar
+// never wraps around onto a bucket that is still to be delivered. At the start of every tick the packets arriving in it are
+// handed over to the receiving nodes, which the scheduler then visits. A packet sent with no delay is handed over at once,
+// so with all the delays set to zero the simulation runs in rounds as if it had no clock. The events refer to the packets
+// by their handles in the packet pools of PacketPool.h.
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+using namespace std;
+
+class EventQueue
+{
+	public:
+	EventQueue()
+	{
+		init(0);
+	}
+
+	/**
+	<@function. init
+	<@brief. Reset the clock to tick 0 and drop the packets in flight, for a network of the given number of nodes.
+		All the delays are set to zero.
+	*/
+	void init(int nodesNum)
+	{
+		m_now = 0;
+		m_defaultLinkDelay = 0;
+		m_processingDelays = vector<int>(nodesNum, 0);
+		m_linkDelays = unordered_map<long long, int>();
+		m_calendar = vector<CalendarBucket>(1);
+		m_eventsNum = 0;
+		m_pendingEventsNum = 0;
+	}
+
+	/**
+	<@function. setDefaultLinkDelay
+	<@brief. Set the delay (in ticks) of the links that are not given a delay of their own.
+	*/
+	void setDefaultLinkDelay(int delay)
+	{
+		m_defaultLinkDelay = delay;
+	}
+
+	/**
+	<@function. setLinkDelay
+	<@brief. Set the delay (in ticks) of the link between two nodes, in both directions.
+	*/
+	void setLinkDelay(int node1, int node2, int delay)
+	{
+		m_linkDelays[getLinkKey(node1, node2)] = delay;
+		m_linkDelays[getLinkKey(node2, node1)] = delay;
+	}
+
+	/**
+	<@function. setProcessingDelay
+	<@brief. Set the time (in ticks) a node takes to process a packet before the packets it sends leave it.
+	*/
+	void setProcessingDelay(int id, int delay)
+	{
+		m_processingDelays[id] = delay;
+	}
+
+	/**
+	<@function. getDelay
+	<@brief. Get the time a packet sent by a node takes to arrive at a neighbour.
+	<@param. from, the sending node.
+	<@param. to, the receiving node.
+	*/
+	int getDelay(int from, int to) const
+	{
+		unordered_map<long long, int>::const_iterator iter = m_linkDelays.find(getLinkKey(from, to));
+		return m_processingDelays[from] + (m_linkDelays.end() == iter ? m_defaultLinkDelay : iter->second);
+	}
+
+	/**
+	<@function. getNow
+	<@brief. Get the current tick.
+	*/
+	int getNow() const
+	{
+		return m_now;
+	}
+
+	/**
+	<@function. scheduleInterestPacket
+	<@brief. Let an Interest packet arrive at a node after the given positive delay.
+	<@param. interestPacket, the handle of the Interest packet in the Interest packet pool.
+	*/
+	void scheduleInterestPacket(int to, int interestPacket, int delay)
+	{
+		getBucket(delay).interestArrivals.push_back(make_pair(to, interestPacket));
+		++m_pendingEventsNum;
+	}
+
+	/**
+	<@function. scheduleDataPacket
+	<@brief. Let a Data packet arrive at a node after the given positive delay.
+	<@param. dataPacket, the handle of the Data packet in the Data packet pool.
+	*/
+	void scheduleDataPacket(int to, int dataPacket, int delay)
+	{
+		getBucket(delay).dataArrivals.push_back(make_pair(to, dataPacket));
+		++m_pendingEventsNum;
+	}
+
+	/**
+	<@function. advance
+	<@brief. Move the clock on to the next tick, and hand the packets arriving in it over to the receiving nodes.
+	<@param. nodes, all the nodes in the network, indexed by their IDs.
+	*/
+	template<class NodeType>
+	void advance(vector<NodeType>& nodes)
+	{
+		++m_now;
+		CalendarBucket& bucket = m_calendar[m_now & (m_calendar.size() - 1)];
+		for(vector<pair<int, int> >::iterator iter(bucket.interestArrivals.begin()), end(bucket.interestArrivals.end());
+			iter != end; ++iter)
+			nodes[iter->first].deliverInterestPacket(iter->second);
+		for(vector<pair<int, int> >::iterator iter(bucket.dataArrivals.begin()), end(bucket.dataArrivals.end());
+			iter != end; ++iter)
+			nodes[iter->first].deliverDataPacket(iter->second);
+		int deliveredNum = bucket.interestArrivals.size() + bucket.dataArrivals.size();
+		m_eventsNum += deliveredNum;
+		m_pendingEventsNum -= deliveredNum;
+		bucket.interestArrivals.clear();
+		bucket.dataArrivals.clear();
+	}
+
+	/**
+	<@function. getEventsNum
+	<@brief. Get the number of arrival events delivered since the queue was initialized.
+	*/
+	long long getEventsNum() const
+	{
+		return m_eventsNum;
+	}
+
+	/**
+	<@function. getPendingEventsNum
+	<@brief. Get the number of packets in flight.
+	*/
+	int getPendingEventsNum() const
+	{
+		return m_pendingEventsNum;
+	}
+
+	private:
+	/**
+	<@brief. The handles of the packets arriving in a tick, with the IDs of the nodes they arrive at, in the order they were sent.
+	*/
+	struct CalendarBucket
+	{
+		vector<pair<int, int> > interestArrivals;
+		vector<pair<int, int> > dataArrivals;
+	};
+
+	long long getLinkKey(int from, int to) const
+	{
+		return ((long long)from << 32) | (unsigned int)to;
+	}
+
+	/**
+	<@function. getBucket
+	<@brief. Get the bucket of the tick the given delay ahead, first growing the calendar if the delay does not fit in it.
+	*/
+	CalendarBucket& getBucket(int delay)
+	{
+		if(delay >= (int)m_calendar.size())
+		{
+			int bucketsNum = m_calendar.size();
+			while(bucketsNum <= delay)
+				bucketsNum *= 2;
+			vector<CalendarBucket> calendar(bucketsNum);
+			int oldBucketsNum = m_calendar.size();
+			for(int i = 1; i < oldBucketsNum; ++i)
+			{// The events of the tick m_now + i keep their tick in the larger calendar.
+				int time = m_now + i;
+				calendar[time & (bucketsNum - 1)].interestArrivals.swap(m_calendar[time & (oldBucketsNum - 1)].interestArrivals);
+				calendar[time & (bucketsNum - 1)].dataArrivals.swap(m_calendar[time & (oldBucketsNum - 1)].dataArrivals);
+			}
+			m_calendar.swap(calendar);
+		}
+		return m_calendar[(m_now + delay) & (m_calendar.size() - 1)];
+	}
+
+	int m_now;	//<@brief. The current tick.
+	int m_defaultLinkDelay;	//<@brief. The delay of the links not in m_linkDelays.
+	vector<int> m_processingDelays;	//<@brief. The processing delay of every node.
+	unordered_map<long long, int> m_linkDelays;	//<@brief. The delays of the links set one by one, keyed by the sending node in the high 32 bits and the receiving node in the low 32 bits.
+	vector<CalendarBucket> m_calendar;	//<@brief. The bucket t & (m_calendar.size() - 1) holds the packets arriving in the tick t. The number of buckets is a power of two.
+	long long m_eventsNum;	//<@brief. The number of arrival events delivered.
+	int m_pendingEventsNum;	//<@brief. The number of arrival events still to be delivered.
+};
+
+extern EventQueue eventQueue;
+
+#endif
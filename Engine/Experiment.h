@@ -0,0 +1,458 @@
+// Experiment.h
+// The driver of the experiments. runExperiments runs the experiments listed in data/experiment_configuration.dt of the current
+// directory, one after another or in worker processes, for a routing scheme, i.e., an instantiation of Node, on a topology of
+// Topology.h. runLockstepExperiments runs them for all the six routing schemes at once, on a network set up once per
+// experiment. The main function of every scheme folder only picks the scheme and the topology, e.g.,
+//	return runExperiments<Node<SelectiveCaching, StaticRouting>, RealNetworkTopology>(argc, argv, "selsta");
+// The variant, if any, tells apart the output files of the schemes sharing a name, e.g., the ProSta folders. The output files
+// of a run with another replacement policy than LRU are told apart by the name of the policy after the variant.
+// The state of an experiment is kept in the global variables defined in globals.cpp.
+#ifndef EXPERIMENT_H
+#define EXPERIMENT_H
+
+//#include <vld.h>
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include <map>
+#include <ratio>
+#include <thread>
+#include <ctime>
+
+#include "Node.h"
+#include "CachePolicy.h"
+#include "RoutingPolicy.h"
+#include "Topology.h"
+#include "NameTable.h"
+#include "RouteSetup.h"
+#include "EgoBetweenness.h"
+#include "Scheduler.h"
+#include "EventQueue.h"
+#include "PacketPool.h"
+#include "PopularitySampler.h"
+#include "CachingHash.h"
+#include "ReplacementPolicies.h"
+#include "Random.h"
+#include "SweepRunner.h"
+#include "utility.h"
+using namespace std;
+
+extern bool fibFaceExpiry;
+extern int linkDelay;
+extern int processingDelay;
+extern int sweepWorkersNum;
+extern map<int, string> idPrefix;
+extern vector<float> fileProbabilities;
+extern vector<string> fileNames;
+extern float zipfAlpha;
+extern PopularitySampler::Method popularitySamplerMethod;
+extern unsigned long long randomSeed;
+extern Random setupRandom;
+extern EgoBetweenness egoBetweenness;
+extern bool egoBetweennessCentrality;
+extern CachingHash::Mode cachingHashMode;
+extern ReplacementPolicy::Type replacementPolicyType;
+extern bool replacementPolicyTiming;
+extern bool cacheAdmission;
+extern int cacheAdmissionFrequency;
+extern int responsePacketNum;
+extern ofstream reuseTime;
+extern ofstream retrievalLatency;
+extern int interestTimeout;
+extern int occupancyDumpInterval;
+extern int nodeQueueCapacity;
+extern long long totalRetrievalLatency;
+extern int packetId;
+extern int requiredHopNum;
+extern int measuredHopNum;
+extern int lowerPacketNumLimit;
+extern int upperPacketNumLimit;
+
+/**
+<@function. readArguments
+<@brief. Read the command-line arguments of a run. The first argument, if any, overrides sweepWorkersNum, the second one,
+	if any, selects the replacement policy of the content stores by name, e.g., "arc", and the following ones are options:
+	"timing" sets replacementPolicyTiming, "admission" sets cacheAdmission, and "betweenness" sets egoBetweennessCentrality.
+<@return. If an argument is not valid, the function returns false.
+*/
+inline bool readArguments(int argc, char* argv[])
+{
+	if(argc > 1)
+		sweepWorkersNum = atoi(argv[1]);
+	if(argc > 2 && !parseReplacementPolicy(argv[2], replacementPolicyType))
+	{
+		cerr << "Unknown replacement policy " << argv[2] << ", expected lru, lfu, arc, s3fifo, wtinylfu or weighted." << endl;
+		return false;
+	}
+	for(int i = 3; i < argc; ++i)
+	{
+		if(string(argv[i]) == "timing")
+			replacementPolicyTiming = true;
+		else if(string(argv[i]) == "admission")
+			cacheAdmission = true;
+		else if(string(argv[i]) == "betweenness")
+			egoBetweennessCentrality = true;
+		else
+		{
+			cerr << "Unknown option " << argv[i] << ", expected timing, admission or betweenness." << endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+<@function. setUpExperiment
+<@brief. Build the network of the current experiment and the files it supplies, i.e., everything of the experiment that does
+	not depend on the routing scheme.
+<@param. topology, the topology of the experiment.
+<@param. streams, the random number stream the streams of the experiment are split off. The stream of the set-up is split
+	off it first.
+*/
+template<class TopologyType>
+void setUpExperiment(TopologyType& topology, Random& streams)
+{
+	setupRandom = streams.split();
+	//Build the network, and generate the possible file names set.
+	idPrefix.clear();
+	vector<string> prefixes;
+	topology.construct(prefixes);
+	int producerNum = producers.size();
+	for(int i = 0; i < producerNum; ++i)
+	{
+		idPrefix[producers[i]] = prefixes[i];
+	}
+	generateFileNames(prefixes, fileNames);
+	popularitySampler.init(fileNames.size(), zipfAlpha, popularitySamplerMethod);
+	nameTable.build(fileNames, idPrefix);
+	//Give every file the probability it is requested with, which the weighted replacement policy weighs the Data packets by.
+	double weightsSum = 0;
+	for(int i = 0; i < (int)fileNames.size(); ++i)
+		weightsSum += popularitySampler.getWeight(i);
+	fileProbabilities.assign(fileNames.size(), 0);
+	for(int i = 0; i < (int)fileNames.size(); ++i)
+		fileProbabilities[nameTable.getFileId(fileNames[i])] = popularitySampler.getWeight(i)/weightsSum;
+	//Compute the ego network betweenness centrality of every router if it is asked for. The routers are distributed among the hardware
+	// threads only if the experiments are run one at a time, as they are otherwise run in as many worker processes already.
+	if(egoBetweennessCentrality)
+		egoBetweenness.compute(topologyGraph, routers, 1 == sweepWorkersNum ? thread::hardware_concurrency() : 1);
+}
+
+/**
+<@function. dumpOccupancy
+<@brief. Write how many chunks of every file the content store of every router holds, one line per router and file.
+<@param. foccupancy, the output file.
+<@param. nodes, the nodes in the network.
+<@param. roundsNum, the number of rounds simulated so far.
+<@param. stat, a buffer the snapshots of the content stores are taken into.
+*/
+template<class NodeType>
+void dumpOccupancy(ofstream& foccupancy, const vector<NodeType>& nodes, int roundsNum, vector<ContentStoreStat>& stat)
+{
+	for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+		iter != end; ++iter)
+	{
+		nodes[*iter].getContentStore().getStat(stat);
+		for(vector<ContentStoreStat>::iterator statIter(stat.begin()), statEnd(stat.end());
+			statIter != statEnd; ++statIter)
+			foccupancy << roundsNum << "\t" << *iter << "\t" << nameTable.getFileName(statIter->fileId) << "\t" << statIter->count << endl;
+	}
+}
+
+/**
+<@function. simulateExperiment
+<@brief. Simulate a routing scheme on the network set up for the current experiment, and write the outputs of the scheme.
+<@param. topology, the topology of the experiment, which names the output files.
+<@param. routeSetup, the shortest paths towards the producers of the network.
+<@param. streams, the random number stream the streams of the nodes are split off. It is passed by value, so every scheme
+	simulated on the same set-up gets the same streams, and every end user requests the same files in the same order.
+<@param. scheme, the name of the routing scheme, which the output files are named after.
+<@param. variant, the variant of the scheme appended to the names of the output files, e.g., "_050", may be empty. The name of the
+	replacement policy is appended to it, unless it is LRU, and "_admission" if cacheAdmission is set.
+*/
+template<class NodeType, class TopologyType>
+void simulateExperiment(const TopologyType& topology, const RouteSetup& routeSetup, Random streams, const string& scheme, const string& schemeVariant)
+{
+	vector<NodeType>& nodes = NodeType::nodes;
+	const string variant = schemeVariant + getReplacementPolicySuffix(replacementPolicyType) + (cacheAdmission ? "_admission" : "");
+	string temp;
+	packetId = 0;
+	requiredHopNum = 0;
+	measuredHopNum = 0;
+	lowerPacketNumLimit = 400000;
+	upperPacketNumLimit = 500000;
+	temp = topology.getOutputFileName(scheme, "", variant, ".log");
+	freopen(temp.c_str(), "w", stdout);
+	temp = topology.getOutputFileName(scheme, topology.getHopRatioMetric(), variant, topology.getExtension());
+	freopen(temp.c_str(), "w", stderr);
+	temp = topology.getOutputFileName(scheme, topology.getReuseTimeMetric(), variant, topology.getExtension());
+	reuseTime.open(temp.c_str());
+	temp = topology.getOutputFileName(scheme, "_retrievalLatency", variant, topology.getExtension());
+	retrievalLatency.open(temp.c_str());
+	ofstream foccupancy;
+	vector<ContentStoreStat> occupancyStat;
+	if(occupancyDumpInterval > 0)
+	{
+		temp = topology.getOutputFileName(scheme, "_occupancy", variant, topology.getExtension());
+		foccupancy.open(temp.c_str());
+		foccupancy << "#round	#routerId	#file	#cachedChunksNum" << endl;
+	}
+
+	int contentStoreCapacity = fileNames.size()*100*1024*capacity/routers.size();	// The total content store capacity should be
+	nodes.clear();
+	for(int i = 0; i < nodesNum; ++i)
+	{
+		nodes.push_back(NodeType(i, contentStoreCapacity));
+	}
+	//The links between nodes are those of topologyGraph, built by the topology.
+	//Define the types of the nodes
+	for(vector<int>::iterator iter(producers.begin()), end(producers.end());
+		iter != end; ++iter)
+		nodes[*iter].setType(NodeType::producer);
+	for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+		iter != end; ++iter)
+		nodes[*iter].setType(NodeType::router);
+	for(vector<int>::iterator iter(users.begin()), end(users.end());
+		iter != end; ++iter)
+		nodes[*iter].setType(NodeType::user);
+	//Construct the static FIB for every router.
+	//In our model, since every end user and every producer is connected to only a router,
+	// we don't need to configure the static FIB for the producer nodes.
+	routeSetup.installStaticFibEntries(nodes, idPrefix);
+	if(egoBetweennessCentrality)
+		egoBetweenness.installCentralities(nodes);
+	for(int i = 0; i < nodesNum; ++i)
+	{
+		if(NodeType::producer == nodes[i].getType())
+			continue;
+		nodes[i].setWeight();
+	}
+
+	for(int i = 0; i < nodesNum; ++i)
+		nodes[i].setRandom(streams.split());
+	scheduler.init(nodesNum, streams.split());
+	cachingHash.init(nodesNum, cachingHashMode, streams.split());
+	for(vector<int>::iterator iter(users.begin()), end(users.end());
+		iter != end; ++iter)
+		scheduler.setAlwaysActive(*iter);
+	eventQueue.init(nodesNum);
+	interestPacketPool.clear();
+	dataPacketPool.clear();
+	eventQueue.setDefaultLinkDelay(linkDelay);
+	for(int i = 0; i < nodesNum; ++i)
+		eventQueue.setProcessingDelay(i, processingDelay);
+	totalRetrievalLatency = 0;
+	int roundsNum = 0;
+	clock_t startTime = clock();
+	responsePacketNum = 0;
+	while(true)
+	{
+		scheduler.beginRound();
+		eventQueue.advance(nodes);
+		for(int id = scheduler.next(); -1 != id; id = scheduler.next())
+		{
+			if(NodeType::producer == nodes[id].getType())
+			{
+				nodes[id].producerOperation();
+			}
+			else if(NodeType::router == nodes[id].getType())
+			{
+				nodes[id].processInterestPacket();
+				nodes[id].processDataPacket();
+			}
+			else if(NodeType::user == nodes[id].getType())
+			{
+				int processTime = nodes[id].getRandom().nextInt(4);
+				for(int processIndex = 0; processIndex <= processTime; ++processIndex)
+				{
+					nodes[id].userOperation();
+				}
+			}
+			if(nodes[id].hasPendingPackets())
+				scheduler.activate(id);
+		}
+		++roundsNum;
+		if(occupancyDumpInterval > 0 && 0 == roundsNum%occupancyDumpInterval)
+			dumpOccupancy(foccupancy, nodes, roundsNum, occupancyStat);
+		if(fibFaceExpiry)
+		{
+			for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+				iter != end; ++iter)
+				nodes[*iter].elapseTime(1);
+		}
+		if(responsePacketNum >= 500000)
+			break;
+
+	}
+	float elapsedSeconds = float(clock() - startTime)/CLOCKS_PER_SEC;
+	cout << "rounds = " << roundsNum << ", rounds per second = " << (elapsedSeconds > 0 ? roundsNum/elapsedSeconds : 0) << endl;
+	cout << "events = " << eventQueue.getEventsNum() << ", events per second = " << (elapsedSeconds > 0 ? eventQueue.getEventsNum()/elapsedSeconds : 0) << endl;
+	int timedOutInterestNum = 0, unmatchedDataNum = 0;
+	for(vector<int>::iterator iter(users.begin()), end(users.end());
+		iter != end; ++iter)
+	{
+		timedOutInterestNum += nodes[*iter].getTimedOutInterestNum();
+		unmatchedDataNum += nodes[*iter].getUnmatchedDataNum();
+	}
+	int matchedDataNum = responsePacketNum - unmatchedDataNum;
+	cout << "average retrieval latency = " << (matchedDataNum > 0 ? (float)totalRetrievalLatency/matchedDataNum : 0) << " ticks" << endl;
+	cout << "Interest packets unmet for " << interestTimeout << " ticks = " << timedOutInterestNum
+		<< ", Data packets matching no unmet Interest packet = " << unmatchedDataNum << endl;
+	cout << "peak Interest packets pooled = " << interestPacketPool.getPeakOccupancy() << ", peak Data packets pooled = "
+		<< dataPacketPool.getPeakOccupancy() << endl;
+	if(nodeQueueCapacity > 0)
+	{
+		int droppedInterestsNum = 0, droppedDataNum = 0, givenUpInterestNum = 0;
+		for(typename vector<NodeType>::iterator iter(nodes.begin()), end(nodes.end());
+			iter != end; ++iter)
+		{
+			droppedInterestsNum += iter->getDroppedInterestsNum();
+			droppedDataNum += iter->getDroppedDataNum();
+			givenUpInterestNum += iter->getGivenUpInterestNum();
+		}
+		cout << "Interest packets dropped at full queues = " << droppedInterestsNum << ", Data packets dropped at full queues = "
+			<< droppedDataNum << ", Interest packets given up by the end users = " << givenUpInterestNum << endl;
+	}
+	long long hitsNum = 0, missesNum = 0, evictionsNum = 0, policyNanoseconds = 0;
+	long long admissionCandidatesNum = 0, admissionRejectionsNum = 0, admissionNanoseconds = 0;
+	for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+		iter != end; ++iter)
+	{
+		const ContentStore& contentStore = nodes[*iter].getContentStore();
+		hitsNum += contentStore.getHitsNum();
+		missesNum += contentStore.getMissesNum();
+		evictionsNum += contentStore.getEvictionsNum();
+		policyNanoseconds += contentStore.getPolicyNanoseconds();
+		admissionCandidatesNum += contentStore.getAdmissionCandidatesNum();
+		admissionRejectionsNum += contentStore.getAdmissionRejectionsNum();
+		admissionNanoseconds += contentStore.getAdmissionNanoseconds();
+	}
+	cout << "replacement policy = " << getReplacementPolicyName(replacementPolicyType) << ", content store hits = " << hitsNum
+		<< ", misses = " << missesNum << ", hit ratio = " << (hitsNum + missesNum > 0 ? (float)hitsNum/(hitsNum + missesNum) : 0)
+		<< ", evictions = " << evictionsNum << endl;
+	if(replacementPolicyTiming)
+		cout << "replacement policy time per lookup = " << (hitsNum + missesNum > 0 ? (float)policyNanoseconds/(hitsNum + missesNum) : 0) << " ns" << endl;
+	if(cacheAdmission)
+	{
+		cout << "cache admission with frequency " << cacheAdmissionFrequency << ": candidates = " << admissionCandidatesNum << ", admitted = "
+			<< admissionCandidatesNum - admissionRejectionsNum << ", admission rate = "
+			<< (admissionCandidatesNum > 0 ? (float)(admissionCandidatesNum - admissionRejectionsNum)/admissionCandidatesNum : 1) << endl;
+		if(replacementPolicyTiming)
+			cout << "cache admission time per lookup = " << (hitsNum + missesNum > 0 ? (float)admissionNanoseconds/(hitsNum + missesNum) : 0) << " ns" << endl;
+	}
+	// Print out the reuse time of Data packets in the routers' content store.
+	for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+		iter != end; ++iter)
+	{
+		nodes[*iter].printDataPacketsReuseTime();
+	}
+
+	cout << "measuredHopNum = " << measuredHopNum << endl;
+	cout << "requiredHopNum = " << requiredHopNum << endl;
+	cout << "measuredHopNum/requiredHopNum = " << (float)measuredHopNum/(float)requiredHopNum << endl;
+	reuseTime.close();
+	retrievalLatency.close();
+	temp = topology.getOutputFileName(scheme, "_cachedPacketsNum", variant, topology.getExtension());
+	ofstream fcachedPacketsNum(temp.c_str());
+	fcachedPacketsNum << "#routerId	#linksNum	#cachedDataPacketsNum	#ratio" << endl;
+	for(vector<int>::iterator iter(routers.begin()), end(routers.end());
+			iter != end; ++iter)
+	{
+		int linksNum = nodes[*iter].getLinksNum();
+		int cachedPacketsNum = nodes[*iter].getCachedDataPacketsNum();
+		fcachedPacketsNum << *iter << "\t" << linksNum << "\t" << cachedPacketsNum << "\t" << (float)cachedPacketsNum*(float)linksNum << endl;
+	}
+	vector<NodeType>().swap(nodes);	// Free the nodes of the scheme before the next scheme is simulated on the same set-up.
+}
+
+/**
+<@function. runExperiments
+<@brief. Run the experiments of the configuration file.
+<@param. argc, argv, the command-line arguments, see readArguments.
+<@param. scheme, the name of the routing scheme, which the output files are named after.
+<@param. variant, the variant of the scheme appended to the names of the output files, e.g., "_050", may be empty.
+<@return. The exit status of the program, 0 if all the experiments succeeded.
+*/
+template<class NodeType, class TopologyType>
+int runExperiments(int argc, char* argv[], const string& scheme, const string& variant = "")
+{
+	TopologyType topology;
+	ifstream fconfig("data/experiment_configuration.dt");
+	string temp;
+	getline(fconfig, temp);
+	if(!readArguments(argc, argv))
+		return 1;
+	SweepRunner sweepRunner(sweepWorkersNum > 0 ? sweepWorkersNum : (int)thread::hardware_concurrency());
+	while(sweepRunner.acceptsExperiments() && topology.readExperiment(fconfig))
+	{
+		if(!sweepRunner.startExperiment(experiment))
+			continue;	// The experiment is run by a worker process.
+		Random streams(randomSeed);	// Every stream split off it is independent of the others.
+		setUpExperiment(topology, streams);
+		//Compute the shortest paths towards the producers, one breadth-first search per producer. The searches are distributed
+		// among the hardware threads only if the experiments are run one at a time, as the betweenness centrality is.
+		RouteSetup routeSetup(topologyGraph);
+		routeSetup.computeRoutes(producers, 1 == sweepWorkersNum ? thread::hardware_concurrency() : 1);
+		simulateExperiment<NodeType>(topology, routeSetup, streams, scheme, variant);
+	}
+	fconfig.close();
+	return 0 == sweepRunner.waitAll() ? 0 : 1;
+}
+
+/**
+<@function. simulateScheme
+<@brief. Simulate a routing scheme of a lockstep run on the network set up for the current experiment, in a worker process of
+	its own if the sweep runner has more than one worker. A worker process simulates only the scheme it was forked for.
+*/
+template<class NodeType, class TopologyType>
+void simulateScheme(SweepRunner& sweepRunner, const TopologyType& topology, const RouteSetup& routeSetup, const Random& streams,
+	const string& scheme, const string& variant = "")
+{
+	if(!sweepRunner.acceptsExperiments())
+		return;
+	if(sweepRunner.startExperiment(experiment + "_" + scheme + variant))
+		simulateExperiment<NodeType>(topology, routeSetup, streams, scheme, variant);
+}
+
+/**
+<@function. runLockstepExperiments
+<@brief. Run the experiments of the configuration file with all the six routing schemes. The network, the routes and the
+	files of an experiment are set up once, and every scheme is simulated on them with the same random number streams, so
+	that every end user requests the same files in the same order under every scheme, and the schemes can be compared
+	request by request. The schemes of an experiment are simulated concurrently, each in a worker process forked right after
+	the set-up. The output files are named as those of the scheme folders.
+<@param. argc, argv, the command-line arguments, see readArguments.
+<@return. The exit status of the program, 0 if all the schemes of all the experiments succeeded.
+*/
+template<class TopologyType>
+int runLockstepExperiments(int argc, char* argv[])
+{
+	TopologyType topology;
+	ifstream fconfig("data/experiment_configuration.dt");
+	string temp;
+	getline(fconfig, temp);
+	if(!readArguments(argc, argv))
+		return 1;
+	SweepRunner sweepRunner(sweepWorkersNum > 0 ? sweepWorkersNum : (int)thread::hardware_concurrency());
+	while(sweepRunner.acceptsExperiments() && topology.readExperiment(fconfig))
+	{
+		Random streams(randomSeed);
+		setUpExperiment(topology, streams);
+		RouteSetup routeSetup(topologyGraph);
+		routeSetup.computeRoutes(producers, 1 == sweepWorkersNum ? thread::hardware_concurrency() : 1);
+		simulateScheme<Node<SelectiveCaching, DynamicRouting> >(sweepRunner, topology, routeSetup, streams, "sado");
+		simulateScheme<Node<SelectiveCaching, StaticRouting> >(sweepRunner, topology, routeSetup, streams, "selsta");
+		simulateScheme<Node<AlwaysCaching, StaticRouting> >(sweepRunner, topology, routeSetup, streams, "persta");
+		simulateScheme<Node<ProbabilisticCaching<ratio<1, 4> >, StaticRouting> >(sweepRunner, topology, routeSetup, streams, "prosta");
+		simulateScheme<Node<ProbabilisticCaching<ratio<1, 2> >, StaticRouting> >(sweepRunner, topology, routeSetup, streams, "prosta", "_050");
+		simulateScheme<Node<ProbabilisticCaching<ratio<3, 4> >, StaticRouting> >(sweepRunner, topology, routeSetup, streams, "prosta", "_075");
+	}
+	fconfig.close();
+	return 0 == sweepRunner.waitAll() ? 0 : 1;
+}
+
+#endif
@@ -7,12 +7,12 @@
 class FaceInfo	//<@brief Record the relevant information about a face associated to a particular prefix.
 {	
 	public:
-	FaceInfo(int face, float metric, long long num, int lifetime)
+	FaceInfo(int face, float metric, long long num, int expiryTime)
 	{
 		m_face = face;
 		m_metric = metric;
 		m_num = num;
-		m_lifetime = lifetime;
+		m_expiryTime = expiryTime;
 	}
 	
 	FaceInfo(int face)
@@ -20,7 +20,7 @@ class FaceInfo	//<@brief Record the relevant information about a face associated
 		m_face = face;
 		m_metric =0;
 		m_num = 0;
-		m_lifetime = 0;
+		m_expiryTime = 0;
 	}
 	
 	FaceInfo(const FaceInfo& other)
@@ -28,7 +28,7 @@ class FaceInfo	//<@brief Record the relevant information about a face associated
 		m_face = other.getFace();
 		m_metric = other.getMetric();
 		m_num = other.getNum();
-		m_lifetime = other.getLifetime();
+		m_expiryTime = other.getExpiryTime();
 	}
 	
 	bool operator<(const FaceInfo& other) const
@@ -41,7 +41,7 @@ class FaceInfo	//<@brief Record the relevant information about a face associated
 		m_face = other.getFace();
 		m_metric = other.getMetric();
 		m_num = other.getNum();
-		m_lifetime = other.getLifetime();
+		m_expiryTime = other.getExpiryTime();
 	}
 	
 	void setFace(int face)
@@ -74,14 +74,14 @@ class FaceInfo	//<@brief Record the relevant information about a face associated
 		return m_num;
 	}
 	
-	void setLifetime(int lifetime)
+	void setExpiryTime(int expiryTime)
 	{
-		m_lifetime = lifetime;
+		m_expiryTime = expiryTime;
 	}
 	
-	int getLifetime() const
+	int getExpiryTime() const
 	{
-		return m_lifetime;
+		return m_expiryTime;
 	}
 
 	/**
@@ -90,13 +90,13 @@ class FaceInfo	//<@brief Record the relevant information about a face associated
 	*/
 	void print() const
 	{
-		cout << "face = " << m_face << ", metric = " << m_metric << ", num = " << m_num << ", lifetime = " << m_lifetime << endl;
+		cout << "face = " << m_face << ", metric = " << m_metric << ", num = " << m_num << ", expiry time = " << m_expiryTime << endl;
 	}
 	
 	private:
 	int m_face;	  //<@brief Throught which the caching Data packets could be reacched.
 	float m_metric;    //<@brief The distance from the current router to the caching router.
 	long long m_num;       //<@brief The number of Data packets cached at the caching router.
-	int m_lifetime;	//<@brief The lifetime of the face.
+	int m_expiryTime;	//<@brief The time after which the face expires, on the clock of its dynamic FIB.
 };
 #endif
@@ -0,0 +1,110 @@
+// FrequencySketch.h
+// The frequency sketch estimates how often the Data packets of a name have been requested lately, in the little memory of a
+// count-min sketch: every name is counted in one counter of each of four rows, chosen by four hashes of the name, and its
+// frequency is estimated by the smallest of the four. The counters saturate at 15, and once there have been ten times as
+// many requests counted as there are counters in a row, all the counters are halved, so the old requests fade away, as in
+// Einziger, Friedman and Manes's "TinyLFU: A Highly Efficient Cache Admission Policy".
+#ifndef FREQUENCY_SKETCH_H
+#define FREQUENCY_SKETCH_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "NameTable.h"
+using namespace std;
+
+class FrequencySketch
+{
+	public:
+	FrequencySketch()
+	{
+		m_counters = vector<unsigned char>();
+		m_mask = 0;
+		m_additions = 0;
+		m_sampleSize = 0;
+	}
+
+	/**
+	<@function. ensureCapacity
+	<@brief. Make sure the rows have at least as many counters as the number of Data packets given, rounded up to a power of two.
+		If the rows are widened, the counts so far are dropped.
+	*/
+	void ensureCapacity(int dataPacketsNum)
+	{
+		int width = 16;
+		while(width < dataPacketsNum)
+			width *= 2;
+		if(width <= m_mask + 1 && !m_counters.empty())
+			return;
+		m_counters = vector<unsigned char>(rowsNum*width, 0);
+		m_mask = width - 1;
+		m_additions = 0;
+		m_sampleSize = 10*width;
+	}
+
+	/**
+	<@function. increment
+	<@brief. Count a request of a name.
+	<@return. If the counters have been halved after counting it, the function returns true.
+	*/
+	bool increment(const Name& name)
+	{
+		if(m_counters.empty())
+			ensureCapacity(0);
+		unsigned long long hash = NameHash()(name);
+		for(int row = 0; row < rowsNum; ++row)
+		{
+			unsigned char& counter = m_counters[row*(m_mask + 1) + getIndex(hash, row)];
+			if(counter < 15)
+				++counter;
+		}
+		if(++m_additions < m_sampleSize)
+			return false;
+		halve();
+		return true;
+	}
+
+	/**
+	<@function. estimate
+	<@brief. Estimate the number of requests of a name counted lately.
+	*/
+	int estimate(const Name& name) const
+	{
+		if(m_counters.empty())
+			return 0;
+		unsigned long long hash = NameHash()(name);
+		int frequency = 15;
+		for(int row = 0; row < rowsNum; ++row)
+			frequency = min(frequency, (int)m_counters[row*(m_mask + 1) + getIndex(hash, row)]);
+		return frequency;
+	}
+
+	private:
+	int getIndex(unsigned long long hash, int row) const
+	{
+		unsigned long long key = hash + (row + 1)*0x9e3779b97f4a7c15ULL;
+		key ^= key >> 31;
+		key *= 0xbf58476d1ce4e5b9ULL;
+		key ^= key >> 29;
+		return (int)(key & m_mask);
+	}
+
+	void halve()
+	{
+		for(vector<unsigned char>::iterator iter(m_counters.begin()), end(m_counters.end());
+			iter != end; ++iter)
+			*iter >>= 1;
+		m_additions /= 2;
+	}
+
+	static const int rowsNum = 4;	//<@brief. The number of rows, i.e., of hashes of a name.
+
+	vector<unsigned char> m_counters;	//<@brief. The counters, row by row.
+	int m_mask;	//<@brief. The number of counters in a row, a power of two, minus 1.
+	int m_additions;	//<@brief. The number of requests counted since the counters were last halved, itself halved with them.
+	int m_sampleSize;	//<@brief. The number of requests after which the counters are halved.
+};
+
+#endif
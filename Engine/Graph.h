@@ -0,0 +1,158 @@
+// Graph.h
+// The graph is the adjacency of the whole topology in the compressed sparse row form: the neighbours of every node are kept
+// in increasing order of their IDs, one list after another in a single vector, and an offset vector tells where the list of
+// every node begins. It takes memory linear in the number of nodes and links, however large the topology. The topology
+// builds it once it has read the links of an experiment, and the links of the nodes, the routes towards the producers and
+// the ego network betweenness centrality are all worked out from it.
+#ifndef GRAPH_H
+#define GRAPH_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using namespace std;
+
+class Graph
+{
+	public:
+	Graph()
+	{
+		m_nodesNum = 0;
+		m_offsets = vector<int>(1, 0);
+		m_neighbours = vector<int>();
+	}
+
+	/**
+	<@function. Graph
+	<@brief. Build the adjacency of the network. A link given more than once is kept once.
+	<@param. nodesNum, the number of nodes in the network.
+	<@param. links, the links between nodes in the network.
+	*/
+	Graph(int nodesNum, const vector<pair<int, int> >& links)
+	{
+		m_nodesNum = nodesNum;
+		m_offsets = vector<int>(nodesNum + 1, 0);
+		m_neighbours = vector<int>(2*links.size());
+		for(vector<pair<int, int> >::const_iterator iter(links.begin()), end(links.end());
+			iter != end; ++iter)
+		{
+			++m_offsets[iter->first + 1];
+			++m_offsets[iter->second + 1];
+		}
+		for(int i = 0; i < nodesNum; ++i)
+			m_offsets[i + 1] += m_offsets[i];
+		// Fill the neighbours by scanning the nodes in increasing order, so that every neighbour list comes out sorted.
+		vector<vector<int> > incident(nodesNum);
+		for(vector<pair<int, int> >::const_iterator iter(links.begin()), end(links.end());
+			iter != end; ++iter)
+		{
+			incident[iter->first].push_back(iter->second);
+			incident[iter->second].push_back(iter->first);
+		}
+		vector<int> cursor(m_offsets.begin(), m_offsets.end() - 1);
+		for(int i = 0; i < nodesNum; ++i)
+		{
+			for(vector<int>::iterator iter(incident[i].begin()), end(incident[i].end());
+				iter != end; ++iter)
+				m_neighbours[cursor[*iter]++] = i;
+		}
+		// Drop the repeated links, compacting the lists towards the front.
+		int size = 0;
+		for(int i = 0; i < nodesNum; ++i)
+		{
+			int first = size;
+			for(int k = m_offsets[i]; k < m_offsets[i + 1]; ++k)
+			{
+				if(size == first || m_neighbours[size - 1] != m_neighbours[k])
+					m_neighbours[size++] = m_neighbours[k];
+			}
+			m_offsets[i] = first;
+		}
+		m_offsets[nodesNum] = size;
+		m_neighbours.resize(size);
+	}
+
+	int getNodesNum() const
+	{
+		return m_nodesNum;
+	}
+
+	/**
+	<@function. getLinksNum
+	<@brief. Get the number of links in the network.
+	*/
+	int getLinksNum() const
+	{
+		return m_neighbours.size()/2;
+	}
+
+	/**
+	<@function. getDegree
+	<@brief. Get the number of nodes a node is connected to.
+	*/
+	int getDegree(int node) const
+	{
+		return m_offsets[node + 1] - m_offsets[node];
+	}
+
+	/**
+	<@function. getNeighbours
+	<@brief. Get the nodes a node is connected to, in increasing order of their IDs. They are neighbours[0] to neighbours[getDegree(node) - 1].
+	*/
+	const int* getNeighbours(int node) const
+	{
+		return m_neighbours.data() + m_offsets[node];
+	}
+
+	/**
+	<@function. hasLink
+	<@brief. Check if two nodes are connected.
+	*/
+	bool hasLink(int node1, int node2) const
+	{
+		return binary_search(getNeighbours(node1), getNeighbours(node1) + getDegree(node1), node2);
+	}
+
+	/**
+	<@function. breadthFirstSearch
+	<@brief. Get the hop count from a node to every other node.
+	<@param. origin, the node the search starts from.
+	<@param. distances, a reference variable, the hop count to every node will be saved in it, or -1 if the node is unreachable.
+	<@param. order, a reference variable, the reachable nodes will be saved in it in the order they are reached, i.e., in the order of
+		their distances, the nodes at the same distance in the order of the neighbour lists.
+	*/
+	void breadthFirstSearch(int origin, vector<int>& distances, vector<int>& order) const
+	{
+		distances.assign(m_nodesNum, -1);
+		order.clear();
+		order.reserve(m_nodesNum);
+		distances[origin] = 0;
+		order.push_back(origin);
+		// The nodes are visited in the order of their distances, so the visited part of the vector doubles as the queue.
+		for(int head = 0; head < (int)order.size(); ++head)
+		{
+			int temp = order[head];
+			for(int k = m_offsets[temp]; k < m_offsets[temp + 1]; ++k)
+			{
+				int neighbour = m_neighbours[k];
+				if(-1 == distances[neighbour])
+				{
+					distances[neighbour] = distances[temp] + 1;
+					order.push_back(neighbour);
+				}
+			}
+		}
+	}
+
+	private:
+	int m_nodesNum;	//<@brief. The number of nodes in the network.
+	vector<int> m_offsets;	//<@brief. The neighbours of node i are m_neighbours[m_offsets[i]] to m_neighbours[m_offsets[i + 1] - 1].
+	vector<int> m_neighbours;	//<@brief. The neighbour lists of all nodes, one after another.
+};
+
+extern Graph topologyGraph;
+
+#endif
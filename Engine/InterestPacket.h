@@ -6,12 +6,32 @@
 
 #include <set>
 #include <string>
+#include <memory>
+
+#include "NameTable.h"
 using namespace std;
 
+// An Interest packet is moved from queue to queue. Its name is interned in the name table, and its unavailable face set is
+// shared by its copies until one of them inserts a face into its own, so copying an Interest packet never copies the set.
 class InterestPacket
 {
 	public:
-	InterestPacket(string name)
+	InterestPacket()
+	{
+		m_name = Name();
+		m_ttl = 20;
+		m_currentRouterDist = 0;
+		m_cachingRouterDist = 0;
+		m_hashValue = 0;
+		m_weight = 0;
+		m_arrivalFace = -1;
+		m_type = unknow;
+		m_hopCount = 0;
+		m_unavailableFaces = shared_ptr<set<int> >();
+		m_id = -1;
+	}
+
+	InterestPacket(const Name& name)
 	{
 		m_name = name;
 		m_ttl = 20;
@@ -22,11 +42,11 @@ class InterestPacket
 		m_arrivalFace = -1;
 		m_type = normal;
 		m_hopCount = 0;
-		m_unavailableFaces = set<int>();
+		m_unavailableFaces = shared_ptr<set<int> >();
 		m_id = -1;
 	}
 	
-	InterestPacket(string name, int ttl)
+	InterestPacket(const Name& name, int ttl)
 	{
 		m_name = name;
 		m_ttl = ttl;
@@ -37,53 +57,26 @@ class InterestPacket
 		m_arrivalFace = -1;
 		m_type = normal;
 		m_hopCount = 0;
-		m_unavailableFaces = set<int>();
+		m_unavailableFaces = shared_ptr<set<int> >();
 		m_id = -1;
 	}
 	
-	InterestPacket(const InterestPacket& other)
-	{
-		m_name = other.getName ();
-		m_ttl = other.getTtl();
-		m_currentRouterDist = other.m_currentRouterDist;
-		m_cachingRouterDist = other.m_cachingRouterDist;
-		m_hashValue = other.getHashValue();
-		m_weight = other.getWeight();
-		m_arrivalFace = other.getArrivalFace();
-		m_unavailableFaces = set<int>();
-		other.getUnavailableFaces(m_unavailableFaces);
-		m_type = other.getType();
-		m_hopCount = other.m_hopCount;
-		m_id = other.m_id;
-	}
-
-	void operator=(const InterestPacket& other)
-	{
-		m_name = other.getName ();
-		m_ttl = other.getTtl();
-		m_currentRouterDist = other.m_currentRouterDist;
-		m_cachingRouterDist = other.m_cachingRouterDist;
-		m_hashValue = other.getHashValue();
-		m_weight = other.getWeight();
-		m_arrivalFace = other.getArrivalFace();
-		m_unavailableFaces = set<int>();
-		other.getUnavailableFaces(m_unavailableFaces);
-		m_type = other.getType();
-		m_hopCount = other.m_hopCount;
-		m_id = other.m_id;
-	}
+	InterestPacket(const InterestPacket& other) = default;
+	InterestPacket(InterestPacket&& other) = default;
+	InterestPacket& operator=(const InterestPacket& other) = default;
+	InterestPacket& operator=(InterestPacket&& other) = default;
 	
 	bool operator==(const InterestPacket& other) const
 	{
 		return m_name == other.getName();
 	}
 	
-	void setName(string name)
+	void setName(const Name& name)
 	{
 		m_name = name;
 	}
 	
-	string getName() const
+	const Name& getName() const
 	{
 		return m_name;
 	}
@@ -168,13 +161,11 @@ class InterestPacket
 		return m_arrivalFace;
 	}
 	
-	void getUnavailableFaces(set<int>& unavailableFaces) const
+	const set<int>& getUnavailableFaces() const
 	{
-		unavailableFaces.clear();
-		for(set<int>::const_iterator iter(m_unavailableFaces.begin()), end(m_unavailableFaces.end());
-			iter != end; ++iter)
-			unavailableFaces.insert(*iter);
-	}	
+		static const set<int> noUnavailableFaces;
+		return m_unavailableFaces ? *m_unavailableFaces : noUnavailableFaces;
+	}
 	
 	/**
 	<@function. insertUnavailableFace
@@ -184,7 +175,15 @@ class InterestPacket
 	*/	
 	void insertUnavailableFace(int face)
 	{
-		m_unavailableFaces.insert(face);
+		if(!m_unavailableFaces)
+			m_unavailableFaces = make_shared<set<int> >();
+		else if(1 != m_unavailableFaces.use_count())
+		{
+			if(m_unavailableFaces->count(face))
+				return;
+			m_unavailableFaces = make_shared<set<int> >(*m_unavailableFaces);
+		}
+		m_unavailableFaces->insert(face);
 	}
 	
 	enum Type{normal, nack, unknow};
@@ -206,10 +205,11 @@ class InterestPacket
 	<@return. If the given face is not in the Interest packet's unavailable face list, the ruturn value is true. 
 		Otherwise the function returns false.
 	*/
-	bool isFaceAvailable(int face)
+	bool isFaceAvailable(int face) const
 	{
-		set<int>::iterator iter = m_unavailableFaces.find(face);
-		if(m_unavailableFaces.end() == iter) return true;
+		const set<int>& unavailableFaces = getUnavailableFaces();
+		set<int>::const_iterator iter = unavailableFaces.find(face);
+		if(unavailableFaces.end() == iter) return true;
 		else return false;
 	}
 	
@@ -253,7 +253,8 @@ class InterestPacket
 		cout << "weight: " << m_weight << endl;
 		cout << "arrival face: " << m_arrivalFace << endl;
 		cout << "unavailable faces: ";
-		for(set<int>::iterator iter(m_unavailableFaces.begin()), end(m_unavailableFaces.end());
+		const set<int>& unavailableFaces = getUnavailableFaces();
+		for(set<int>::const_iterator iter(unavailableFaces.begin()), end(unavailableFaces.end());
 			iter != end; ++iter)
 			cout << *iter << " ";
 		cout << endl;
@@ -266,7 +267,7 @@ class InterestPacket
 	}
 
 	private:
-	string m_name;	//<@brief. The name of the Interest packet.
+	Name m_name;	//<@brief. The interned name of the Interest packet.
 	int m_ttl;	//<@brief. The time-to-live (in hops) of the Data packet.
 	int m_currentRouterDist;	//<@brief. The distance from the end user to the current router.
 	int m_cachingRouterDist;	//<@brief. The distance from the end user to the caching router.
@@ -275,8 +276,8 @@ class InterestPacket
 	int m_arrivalFace;	//<@brief. The arrival face of the Interest packet. In the framework, 
 	// we take a node's ID as the face corresponding to it. So when node A forwards the Interest packet to another node, say node B, 
 	// node A will set the arrival face of the Interest packet as its own ID.
-	set<int> m_unavailableFaces;	//<@brief. When a face is proved that the requested Data packet cannot be reached through it, 
-	// the face will be added to the face set.
+	shared_ptr<set<int> > m_unavailableFaces;	//<@brief. When a face is proved that the requested Data packet cannot be reached through it, 
+	// the face will be added to the face set. The set is shared by the copies of the Interest packet, and null if it is empty.
 	Type m_type;	// The type of the Interest packet. When the node receives a NACK packet corresponding to the Interest packet, 
 	// the type field of the Interest packet will be set to nack, which means even if PIT entry corresponds to the Interest packet
 	// exists, the Interest packet will be sent again.
@@ -0,0 +1,183 @@
+// LfuPolicy.h
+// The least frequently used replacement policy, in the constant time form of Shah, Mitra and Matani's "An O(1) algorithm for
+// implementing the LFU cache eviction scheme": the slots of the same frequency are kept in a bucket, from the most recently
+// used to the least recently used, and the buckets are chained in increasing order of their frequencies. A hit moves a slot
+// into the bucket of the next frequency, creating it if need be, and the least recently used slot of the lowest frequency
+// is evicted.
+#ifndef LFU_POLICY_H
+#define LFU_POLICY_H
+
+//#include <vld.h>
+
+#include <vector>
+
+#include "ReplacementPolicy.h"
+using namespace std;
+
+class LfuPolicy : public ReplacementPolicy
+{
+	public:
+	LfuPolicy()
+	{
+		m_buckets = vector<Bucket>();
+		m_slots = vector<Slot>();
+		m_lowest = -1;
+		m_highest = -1;
+		m_freeBucket = -1;
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new LfuPolicy(*this);
+	}
+
+	void insert(int slot, const Name&, bool atFront)
+	{
+		if((int)m_slots.size() <= slot)
+			m_slots.resize(slot + 1);
+		if(-1 == m_lowest || 1 != m_buckets[m_lowest].m_frequency)
+			createBucket(1, -1, m_lowest);
+		link(m_lowest, slot, atFront);
+	}
+
+	void access(int slot, const Name&)
+	{
+		int bucket = m_slots[slot].m_bucket;
+		int nextBucket = m_buckets[bucket].m_next;
+		if(-1 == nextBucket || m_buckets[bucket].m_frequency + 1 != m_buckets[nextBucket].m_frequency)
+			nextBucket = createBucket(m_buckets[bucket].m_frequency + 1, bucket, nextBucket);
+		unlink(slot);
+		link(nextBucket, slot, true);
+	}
+
+	int victim()
+	{
+		return m_buckets[m_lowest].m_tail;
+	}
+
+	void erase(int slot, const Name&)
+	{
+		unlink(slot);
+	}
+
+	int first() const
+	{
+		return -1 == m_highest ? -1 : m_buckets[m_highest].m_head;
+	}
+
+	int next(int slot) const
+	{
+		if(-1 != m_slots[slot].m_next)
+			return m_slots[slot].m_next;
+		int bucket = m_buckets[m_slots[slot].m_bucket].m_prev;
+		return -1 == bucket ? -1 : m_buckets[bucket].m_head;
+	}
+
+	private:
+	struct Bucket
+	{
+		int m_frequency;	//<@brief. The number of times the slots in the bucket have been used.
+		int m_prev;	//<@brief. The bucket of the next lower frequency, or -1. For a free bucket it chains the free list.
+		int m_next;	//<@brief. The bucket of the next higher frequency, or -1.
+		int m_head;	//<@brief. The most recently used slot of the bucket.
+		int m_tail;	//<@brief. The least recently used slot of the bucket.
+	};
+
+	struct Slot
+	{
+		int m_bucket;	//<@brief. The bucket the slot is in.
+		int m_prev;	//<@brief. The more recently used slot of the bucket, or -1.
+		int m_next;	//<@brief. The less recently used slot of the bucket, or -1.
+	};
+
+	/**
+	<@function. createBucket
+	<@brief. Create an empty bucket of a frequency between two neighbouring buckets, either of which may be -1.
+	*/
+	int createBucket(int frequency, int prev, int next)
+	{
+		int bucket;
+		if(-1 != m_freeBucket)
+		{
+			bucket = m_freeBucket;
+			m_freeBucket = m_buckets[bucket].m_prev;
+		}
+		else
+		{
+			bucket = m_buckets.size();
+			m_buckets.push_back(Bucket());
+		}
+		m_buckets[bucket].m_frequency = frequency;
+		m_buckets[bucket].m_prev = prev;
+		m_buckets[bucket].m_next = next;
+		m_buckets[bucket].m_head = -1;
+		m_buckets[bucket].m_tail = -1;
+		if(-1 == prev)
+			m_lowest = bucket;
+		else m_buckets[prev].m_next = bucket;
+		if(-1 == next)
+			m_highest = bucket;
+		else m_buckets[next].m_prev = bucket;
+		return bucket;
+	}
+
+	void link(int bucket, int slot, bool atFront)
+	{
+		Bucket& b = m_buckets[bucket];
+		m_slots[slot].m_bucket = bucket;
+		if(atFront)
+		{
+			m_slots[slot].m_prev = -1;
+			m_slots[slot].m_next = b.m_head;
+			if(-1 == b.m_head)
+				b.m_tail = slot;
+			else m_slots[b.m_head].m_prev = slot;
+			b.m_head = slot;
+		}
+		else
+		{
+			m_slots[slot].m_next = -1;
+			m_slots[slot].m_prev = b.m_tail;
+			if(-1 == b.m_tail)
+				b.m_head = slot;
+			else m_slots[b.m_tail].m_next = slot;
+			b.m_tail = slot;
+		}
+	}
+
+	/**
+	<@function. unlink
+	<@brief. Take a slot out of its bucket, and drop the bucket if it becomes empty.
+	*/
+	void unlink(int slot)
+	{
+		int bucket = m_slots[slot].m_bucket;
+		Bucket& b = m_buckets[bucket];
+		int prev = m_slots[slot].m_prev;
+		int next = m_slots[slot].m_next;
+		if(-1 == prev)
+			b.m_head = next;
+		else m_slots[prev].m_next = next;
+		if(-1 == next)
+			b.m_tail = prev;
+		else m_slots[next].m_prev = prev;
+		if(-1 != b.m_head)
+			return;
+		if(-1 == b.m_prev)
+			m_lowest = b.m_next;
+		else m_buckets[b.m_prev].m_next = b.m_next;
+		if(-1 == b.m_next)
+			m_highest = b.m_prev;
+		else m_buckets[b.m_next].m_prev = b.m_prev;
+		b.m_prev = m_freeBucket;
+		m_freeBucket = bucket;
+	}
+
+	vector<Bucket> m_buckets;	//<@brief. The buckets, in use or free.
+	vector<Slot> m_slots;	//<@brief. The links of every slot.
+	int m_lowest;	//<@brief. The bucket of the lowest frequency, or -1 if there is no slot.
+	int m_highest;	//<@brief. The bucket of the highest frequency, or -1 if there is no slot.
+	int m_freeBucket;	//<@brief. The head of the list of free buckets.
+};
+
+#endif
@@ -0,0 +1,61 @@
+// LruPolicy.h
+// The least recently used replacement policy, the one the content stores have always used: a hit moves a Data packet to the
+// front of the recency list, and the Data packet at the back is evicted.
+#ifndef LRU_POLICY_H
+#define LRU_POLICY_H
+
+//#include <vld.h>
+
+#include "ReplacementPolicy.h"
+using namespace std;
+
+class LruPolicy : public ReplacementPolicy
+{
+	public:
+	LruPolicy()
+	{
+		m_lists = SlotLists(1);
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new LruPolicy(*this);
+	}
+
+	void insert(int slot, const Name&, bool atFront)
+	{
+		if(atFront)
+			m_lists.pushFront(0, slot);
+		else m_lists.pushBack(0, slot);
+	}
+
+	void access(int slot, const Name&)
+	{
+		m_lists.moveToFront(0, slot);
+	}
+
+	int victim()
+	{
+		return m_lists.back(0);
+	}
+
+	void erase(int slot, const Name&)
+	{
+		m_lists.remove(slot);
+	}
+
+	int first() const
+	{
+		return m_lists.first();
+	}
+
+	int next(int slot) const
+	{
+		return m_lists.next(slot);
+	}
+
+	private:
+	SlotLists m_lists;	//<@brief. The slots from the most recently used to the least recently used.
+};
+
+#endif
@@ -0,0 +1,240 @@
+// NameTable.h
+// The name of a Data packet has the form <highest level prefix>/<random component>/<number of chunks>/<chunk sequence number>,
+// where everything before the last component is the name of the file the Data packet belongs to. The name table interns every
+// file name once, so a packet only carries the pair (file ID, chunk number), and the content store, the PIT and the FIBs compare
+// and hash integers instead of splitting and concatenating strings. The table also records, for every file, the ID of its
+// highest level prefix, the producer serving it and the number of chunks it is divided into. The original string names are
+// rebuilt only when they are printed.
+#ifndef NAME_TABLE_H
+#define NAME_TABLE_H
+
+//#include <vld.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <sstream>
+#include <iostream>
+#include <cstddef>
+
+using namespace std;
+
+/**
+<@brief. The interned name of an Interest packet or a Data packet.
+*/
+struct Name
+{
+	int fileId;	//<@brief. The ID of the file in the name table, or -1 for an empty name.
+	int chunkNo;	//<@brief. The sequence number of the chunk within the file.
+
+	Name() : fileId(-1), chunkNo(-1)
+	{
+	}
+
+	Name(int file, int chunk) : fileId(file), chunkNo(chunk)
+	{
+	}
+
+	bool operator==(const Name& other) const
+	{
+		return fileId == other.fileId && chunkNo == other.chunkNo;
+	}
+
+	bool operator!=(const Name& other) const
+	{
+		return !(*this == other);
+	}
+
+	bool operator<(const Name& other) const
+	{
+		return fileId < other.fileId || (fileId == other.fileId && chunkNo < other.chunkNo);
+	}
+};
+
+/**
+<@brief. The hash function for the unordered containers keyed by Name.
+*/
+struct NameHash
+{
+	size_t operator()(const Name& name) const
+	{
+		unsigned long long key = ((unsigned long long)(unsigned int)name.fileId << 32) | (unsigned int)name.chunkNo;
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdULL;
+		key ^= key >> 33;
+		return (size_t)key;
+	}
+};
+
+class NameTable
+{
+	public:
+	NameTable()
+	{
+		m_fileNames = vector<string>();
+		m_filePrefixIds = vector<int>();
+		m_fileChunksNums = vector<int>();
+		m_fileIds = map<string, int>();
+		m_prefixes = vector<string>();
+		m_prefixProducers = vector<int>();
+		m_prefixIds = map<string, int>();
+	}
+
+	/**
+	<@function. build
+	<@brief. Intern the file names the network could supply, together with their highest level prefixes.
+		The ID of a file is its position in fileNames. The highest level prefixes are numbered in lexicographical order,
+		so containers ordered by prefix ID keep the order they had when they were ordered by prefix.
+	<@param. fileNames, the names of the files the network could supply.
+	<@param. idPrefix, the highest level prefix served by every producer.
+	*/
+	void build(const vector<string>& fileNames, const map<int, string>& idPrefix)
+	{
+		*this = NameTable();
+		vector<string> filePrefixes;
+		for(vector<string>::const_iterator iter(fileNames.begin()), end(fileNames.end());
+			iter != end; ++iter)
+		{
+			string::size_type first = iter->find('/');
+			string::size_type last = iter->rfind('/');
+			int chunksNum = 0;
+			istringstream(iter->substr(last + 1)) >> chunksNum;
+			m_fileIds[*iter] = m_fileNames.size();
+			m_fileNames.push_back(*iter);
+			m_fileChunksNums.push_back(chunksNum);
+			filePrefixes.push_back(iter->substr(0, first));
+			m_prefixIds[filePrefixes.back()] = -1;
+		}
+		for(map<int, string>::const_iterator iter(idPrefix.begin()), end(idPrefix.end());
+			iter != end; ++iter)
+			m_prefixIds[iter->second] = -1;
+		for(map<string, int>::iterator iter(m_prefixIds.begin()), end(m_prefixIds.end());
+			iter != end; ++iter)
+		{
+			iter->second = m_prefixes.size();
+			m_prefixes.push_back(iter->first);
+			m_prefixProducers.push_back(-1);
+		}
+		for(map<int, string>::const_iterator iter(idPrefix.begin()), end(idPrefix.end());
+			iter != end; ++iter)
+			m_prefixProducers[m_prefixIds[iter->second]] = iter->first;
+		for(vector<string>::iterator iter(filePrefixes.begin()), end(filePrefixes.end());
+			iter != end; ++iter)
+			m_filePrefixIds.push_back(m_prefixIds[*iter]);
+	}
+
+	/**
+	<@function. getFileId
+	<@brief. Look up the ID of a file by its name.
+	<@return. The ID of the file, or -1 if the file is unknown.
+	*/
+	int getFileId(const string& fileName) const
+	{
+		map<string, int>::const_iterator iter = m_fileIds.find(fileName);
+		if(m_fileIds.end() == iter)
+			return -1;
+		return iter->second;
+	}
+
+	/**
+	<@function. getPrefixId
+	<@brief. Look up the ID of a highest level prefix.
+	<@return. The ID of the prefix, or -1 if the prefix is unknown.
+	*/
+	int getPrefixId(const string& prefix) const
+	{
+		map<string, int>::const_iterator iter = m_prefixIds.find(prefix);
+		if(m_prefixIds.end() == iter)
+			return -1;
+		return iter->second;
+	}
+
+	const string& getFileName(int fileId) const
+	{
+		return m_fileNames[fileId];
+	}
+
+	const string& getPrefix(int prefixId) const
+	{
+		return m_prefixes[prefixId];
+	}
+
+	/**
+	<@function. getFilePrefixId
+	<@brief. Get the ID of the highest level prefix of a file, i.e., the key of its static FIB entries.
+	*/
+	int getFilePrefixId(int fileId) const
+	{
+		return m_filePrefixIds[fileId];
+	}
+
+	/**
+	<@function. getProducerId
+	<@brief. Get the ID of the producer serving a file, or -1 if no producer serves its highest level prefix.
+	*/
+	int getProducerId(int fileId) const
+	{
+		return m_prefixProducers[m_filePrefixIds[fileId]];
+	}
+
+	/**
+	<@function. getChunksNum
+	<@brief. Get the number of Data packets a file is divided into.
+	*/
+	int getChunksNum(int fileId) const
+	{
+		return m_fileChunksNums[fileId];
+	}
+
+	int getFilesNum() const
+	{
+		return m_fileNames.size();
+	}
+
+	/**
+	<@function. getNameLength
+	<@brief. Get the length of the string form of a name without building it.
+	*/
+	int getNameLength(const Name& name) const
+	{
+		if(-1 == name.fileId)
+			return 0;
+		int digits = 1;
+		for(int chunkNo = name.chunkNo; chunkNo >= 10; chunkNo /= 10)
+			++digits;
+		return m_fileNames[name.fileId].size() + 1 + digits;
+	}
+
+	/**
+	<@function. toString
+	<@brief. Rebuild the string form of a name.
+	*/
+	string toString(const Name& name) const
+	{
+		if(-1 == name.fileId)
+			return "";
+		ostringstream convert;
+		convert << m_fileNames[name.fileId] << "/" << name.chunkNo;
+		return convert.str();
+	}
+
+	private:
+	vector<string> m_fileNames;	//<@brief. The name of every file, indexed by file ID.
+	vector<int> m_filePrefixIds;	//<@brief. The ID of the highest level prefix of every file.
+	vector<int> m_fileChunksNums;	//<@brief. The number of Data packets every file is divided into.
+	map<string, int> m_fileIds;	//<@brief. Maps a file name to its ID.
+	vector<string> m_prefixes;	//<@brief. The highest level prefixes, indexed by prefix ID.
+	vector<int> m_prefixProducers;	//<@brief. The producer serving every highest level prefix, or -1.
+	map<string, int> m_prefixIds;	//<@brief. Maps a highest level prefix to its ID.
+};
+
+extern NameTable nameTable;
+
+inline ostream& operator<<(ostream& os, const Name& name)
+{
+	if(-1 != name.fileId)
+		os << nameTable.getFileName(name.fileId) << "/" << name.chunkNo;
+	return os;
+}
+
+#endif
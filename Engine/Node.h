@@ -1,5 +1,9 @@
 //Node.h
-//<@brief: The node could act as a client, a server, or a router. 
+//<@brief: The node could act as a client, a server, or a router. The routing scheme the node runs is given by its two
+//	policies, the caching policy of CachePolicy.h and the routing policy of RoutingPolicy.h: SelSta is
+//	Node<SelectiveCaching, StaticRouting>, SADO is Node<SelectiveCaching, DynamicRouting>, PerSta is Node<AlwaysCaching, StaticRouting>,
+//	and ProSta is Node<ProbabilisticCaching<ratio<1, 4> >, StaticRouting> and the like. The steps that differ between the policies
+//	are overloaded on a policy object, so every scheme is compiled into its own code, without branches on the scheme.
 #ifndef NODE_H
 #define NODE_H
 
@@ -12,11 +16,15 @@
 #include <algorithm>
 #include <sstream>
 #include <list>
+#include <unordered_map>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <cmath>
+#include <type_traits>
 
+#include "CachePolicy.h"
+#include "RoutingPolicy.h"
 #include "ContentStore.h"
 #include "Pit.h"
 #include "StaticFib.h"
@@ -28,16 +36,22 @@
 #include "FaceInfo.h"
 #include "utility.h"
 #include "components.h"
+#include "Scheduler.h"
+#include "EventQueue.h"
+#include "PacketPool.h"
+#include "RingQueue.h"
+#include "UnmetInterestTable.h"
+#include "PopularitySampler.h"
+#include "Random.h"
+#include "CachingHash.h"
+#include "Graph.h"
 using namespace std;
-class Node;
 
-extern vector<Node> nodes;
 extern int pitEntryLifetime;
 extern vector<string> fileNames;
 extern map<int, string> idPrefix;
 extern vector<int> users;
 extern int responsePacketNum;
-extern vector<float> fileRequestProbability;
 extern int cacheThreshold;
 extern ofstream reuseTime;
 extern int packetId;
@@ -45,52 +59,83 @@ extern int requiredHopNum;
 extern int measuredHopNum;
 extern int lowerPacketNumLimit;
 extern int upperPacketNumLimit;
+extern int interestTimeout;
+extern ofstream retrievalLatency;
+extern long long totalRetrievalLatency;
+extern int nodeQueueCapacity;
+extern bool cacheAdmission;
 
+template<class CachePolicy, class RoutingPolicy>
 class Node
 {
+	static_assert(!is_same<RoutingPolicy, DynamicRouting>::value || is_same<CachePolicy, SelectiveCaching>::value,
+		"DynamicRouting relies on the caching routers elected by SelectiveCaching.");
+
 	public:
+	static vector<Node> nodes;	//<@brief. All the nodes in the network, including the producers, routers, and end users will be stored in it.
+
 	Node(int id)
 	{
 		m_id = id;
-		m_links = set<int>();
 		m_contentStore = ContentStore(0);
 		m_pit = Pit();
 		m_staticFib = StaticFib();
-		m_dynamicFib = DynamicFib();	
+		m_dynamicFib = DynamicFib();
+		m_faceCosts = vector<FaceCost>();	
 		m_type = unknow;
-		m_dataList = list<DataPacket>();
-		m_interestList = list<InterestPacket>();
-		m_waitingInterestList = list<InterestPacket>();
+		m_dataList = RingQueue<int>();
+		m_dataList.setCapacity(nodeQueueCapacity);
+		m_interestList = RingQueue<int>();
+		m_interestList.setCapacity(nodeQueueCapacity);
+		m_waitingInterests = unordered_map<Name, vector<InterestPacket>, NameHash>();
+		m_waitingInterestsNum = 0;
+		m_nackInterests = unordered_map<Name, vector<int>, NameHash>();
+		m_cancelledInterestsNum = 0;
 		m_betweennessCentrality = -1;
 		m_weight = -1;
-		m_fileToRequest = "";
+		m_fileToRequest = -1;
 		m_dataPacketSeqNum = 100;
 		m_userInterestCount = 0;
 		m_userDataCount = 0;
-		m_unmetInterestList = list<string>();
+		m_unmetInterests = UnmetInterestTable();
+		m_random = Random();
 		m_cachedDataPacketsNum = 0;
+		m_droppedInterestsNum = 0;
+		m_droppedDataNum = 0;
+		m_unmatchedDataNum = 0;
+		enableCacheAdmission(CachePolicy());
 	}
 	
 	Node(int id, long long capacity)
 	{
 		m_id = id;
-		m_links = set<int>();
 		m_contentStore = ContentStore(capacity);
 		m_pit = Pit();
 		m_staticFib = StaticFib();
 		m_dynamicFib = DynamicFib();
+		m_faceCosts = vector<FaceCost>();
 		m_type = unknow;
-		m_dataList = list<DataPacket>();
-		m_interestList = list<InterestPacket>();
-		m_waitingInterestList = list<InterestPacket>();
+		m_dataList = RingQueue<int>();
+		m_dataList.setCapacity(nodeQueueCapacity);
+		m_interestList = RingQueue<int>();
+		m_interestList.setCapacity(nodeQueueCapacity);
+		m_waitingInterests = unordered_map<Name, vector<InterestPacket>, NameHash>();
+		m_waitingInterestsNum = 0;
+		m_nackInterests = unordered_map<Name, vector<int>, NameHash>();
+		m_cancelledInterestsNum = 0;
 		m_betweennessCentrality = -1;
 		m_weight = -1;
-		m_fileToRequest = "";
+		m_fileToRequest = -1;
 		m_dataPacketSeqNum = 100;
 		m_userInterestCount = 0;
 		m_userDataCount = 0;
-		m_unmetInterestList = list<string>();
+		m_unmetInterests = UnmetInterestTable();
+		m_random = Random();
 		m_cachedDataPacketsNum = 0;
+		m_droppedInterestsNum = 0;
+		m_droppedDataNum = 0;
+		m_unmatchedDataNum = 0;
+		enableCacheAdmission(CachePolicy());
 	}
 	
 	~Node()
@@ -102,22 +147,13 @@ class Node
 		return m_id;
 	}
 	
-	void addLink(int link)
-	{
-//		cout << "id = " << m_id << endl;
-		m_links.insert(link);
-	}
-	
-	void eraseLink(int link)
-	{
-		set<int>::iterator iter = m_links.find(link);
-		if(m_links.end() != iter)
-			m_links.erase(iter);
-	}
-	
-	set<int>::size_type getLinksNum()
+	/**
+	<@function. getLinksNum
+	<@brief. Get the number of nodes the node is connected to, in topologyGraph.
+	*/
+	int getLinksNum() const
 	{
-		return m_links.size();
+		return topologyGraph.getDegree(m_id);
 	}
 	
 	
@@ -136,19 +172,19 @@ class Node
 	/**
 	<@function. insertStaticFibEntry
 	<@brief. Insert a static FIB entry into the static FIB of a node.
-	<@param. prefix, the highest level prefix associated to producer.
+	<@param. prefixId, the ID of the highest level prefix associated to producer.
 	<@param. face, through which face the producer associated with the prefix could be reached.
 	<@param. metric, the metric to the producer corresponding to the prefix through static FIB.
 	*/
-	void insertStaticFibEntry(string prefix, int face, float metric)
+	void insertStaticFibEntry(int prefixId, int face, float metric)
 	{
-		m_staticFib.insertEntry(prefix, face, metric);
+		m_staticFib.insertEntry(prefixId, face, metric);
 	}
 	
 	/**
 	<@function. queryStaticFib
 	<@brief. Query the static FIB for the static routing information about a highest level prefix.
-	<@param. prefix, target prefix to be queried about.
+	<@param. prefixId, the ID of the target prefix to be queried about.
 	<@param. flag, a reference variable. If the target information is available, it will be set to true,
 			otherwise it will be set to false.
 	<@param. face, a reference vairable, in the case where target information is available, it 
@@ -156,154 +192,259 @@ class Node
 	<@param. metric, a reference variable, in the case where target inforamtion is available it 
 	will record the distance from the current node to the destination producer.
 	*/
-	void queryStaticFib(string prefix, bool& flag, int& face, float& metric)
+	void queryStaticFib(int prefixId, bool& flag, int& face, float& metric)
 	{
-		m_staticFib.query(prefix, flag, face, metric);
+		m_staticFib.query(prefixId, flag, face, metric);
 	}
 	
+	/**
+	<@function. setRandom
+	<@brief. Give the node the random number stream it draws from.
+	*/
+	void setRandom(const Random& random)
+	{
+		m_random = random;
+	}
+
+	Random& getRandom()
+	{
+		return m_random;
+	}
+
+	/**
+	<@function. hasPendingPackets
+	<@brief. Check if there are Interest packets or Data packets waiting to be processed by the node. The nack Interest packets
+		cancelled in the Interest packet queue are not counted.
+	*/
+	bool hasPendingPackets() const
+	{
+		return m_interestList.size() > m_cancelledInterestsNum || !m_dataList.empty();
+	}
+
 	/**
 	<@function. pendInterestPacket
-	<@brief. Pend an Interest packet to the Interest packet queue of the node.
-	<@param. interestPacket, a reference variable, the Interest packet to be pended.
+	<@brief. Send an Interest packet to the node. The packet arrives after the processing delay of the sender, i.e., its arrival face,
+		plus the delay of the link between them. If there is no delay, it is put into the Interest packet queue of the node at once.
+	<@param. interestPacket, the Interest packet to be pended.
 	*/
 	void pendInterestPacket(InterestPacket interestPacket)
 	{
-			m_interestList.push_back(interestPacket);
+		int delay = eventQueue.getDelay(interestPacket.getArrivalFace(), m_id);
+		int handle = interestPacketPool.allocate(move(interestPacket));
+		if(0 < delay)
+			eventQueue.scheduleInterestPacket(m_id, handle, delay);
+		else deliverInterestPacket(handle);
 	}
 	
 	/**
 	<@function. pendDataPacket
-	<@brief. Pend a Data packet to the Data packet queue of the node.
-	<@param. dataPacket, a reference variable, the Data packet to be pended.
+	<@brief. Send a Data packet to the node. The packet arrives after the processing delay of the sender, i.e., its arrival face,
+		plus the delay of the link between them. If there is no delay, it is put into the Data packet queue of the node at once.
+	<@param. dataPacket, the Data packet to be pended.
 	*/
 	void pendDataPacket(DataPacket dataPacket)
 	{
-		m_dataList.push_back(dataPacket);
+		int delay = eventQueue.getDelay(dataPacket.getArrivalFace(), m_id);
+		int handle = dataPacketPool.allocate(move(dataPacket));
+		if(0 < delay)
+			eventQueue.scheduleDataPacket(m_id, handle, delay);
+		else deliverDataPacket(handle);
 	}
-	
+
 	/**
-	<@function. processNormalDataPacket
-	<@brief. When the Data packet to be processed is a normal Data packet, call the function.
-	<@param. dataPacket, the Data packet to be processed.
+	<@function. deliverInterestPacket
+	<@brief. Put an arrived Interest packet into the Interest packet queue of the node. If the queue is full, the Interest packet
+		is dropped, and a nack Data packet is sent back to the node it came from, which has set up a PIT entry for it.
+	<@param. interestPacket, the handle of the Interest packet in the Interest packet pool.
 	*/
-/*	void processNormalDataPacket(DataPacket dataPacket)
+	void deliverInterestPacket(int interestPacket)
 	{
-		string dataPacketName = dataPacket.getName();
-		InterestPacket interestPacket(dataPacketName);
-		list<InterestPacket>::iterator interestIter;
-		int arrivalFace = dataPacket.getArrivalFace();
-		
-		dataPacket.setArrivalFace(m_id);
-		dataPacket.increaseHopCount();
-
-		list<int> arrivalFaces;
-		list<PitInfo> pitInfos;
-		m_pit.getPitInfos(dataPacketName, pitInfos);
-		m_pit.dropEntry(dataPacketName);
-		for(list<PitInfo>::iterator pitInfoIter(pitInfos.begin()), pitInfoEnd(pitInfos.end());
-			pitInfoIter != pitInfoEnd; ++pitInfoIter)
+		if(m_interestList.isFull())
 		{
-			arrivalFaces.push_back(pitInfoIter->m_arrivalFace);
+			InterestPacket droppedInterestPacket(interestPacketPool.take(interestPacket));
+			++m_droppedInterestsNum;
+			DataPacket nackDataPacket(droppedInterestPacket.getName());
+			nackDataPacket.setType(DataPacket::nack);
+			nackDataPacket.setHopCount(droppedInterestPacket.getHopCount());
+			nackDataPacket.setArrivalFace(m_id);
+			nackDataPacket.setId(droppedInterestPacket.getId());
+			nodes[droppedInterestPacket.getArrivalFace()].pendDataPacket(nackDataPacket);
 		}
+		else m_interestList.push_back(interestPacket);
+		scheduler.activate(m_id);
+	}
 
-		//cout << "normal Data " << dataPacketName << " router " << m_id << "<---" << dataPacket.getArrivalFace() << endl;
-
-		// This packet is a normal Data packet, so we consider caching it or setting up dynamic routing information for it, besides forward it.
-		dataPacket.decreaseCurrentRouterDist();
-
-		// Determine the router will cache it or set up routing information for it, and modify the relevant router list accordingly.
-		if(dataPacket.getCurrentRouterDist() == dataPacket.getCachingRouterDist() || 
-			(dataPacket.getCurrentRouterDist() > dataPacket.getCachingRouterDist() && arrivalFaces.empty()) ||
-			(dataPacket.getCurrentRouterDist() > dataPacket.getCachingRouterDist() && 1 == arrivalFaces.size() && users.end() != find(users.begin(), users.end(), arrivalFaces.front())))
-		{//if the currentRouterDist value is equal to the cachingRouterDist value, or there is nowhere to forward the Interest packet,
-			// or there is only one next node and the node is a user node, cache the Data packet.
-			//cout << "Cache the Data packet " << dataPacketName << endl;
-			cacheDataPacket(dataPacket);	
-			dataPacket.clearRelevantRouters();
-			dataPacket.setCachingRouterId(m_id);
-		}
-		else if(dataPacket.getCurrentRouterDist() < dataPacket.getCachingRouterDist())
-		{// The Data packe has been cached, so we will set up a dynamic fib entry for it.
-			//cout << dataPacketName << " has been cached in some previous node." << endl;
-			//cout << "Set up dynamic routing information for the Data packet " << dataPacketName << endl;
-			vector<int> tempFaces;
-			tempFaces.push_back(arrivalFace);
-			string prefix = trimLastComponentFromName(dataPacket.getName());
-			float metric = dataPacket.getCachingRouterDist() - dataPacket.getCurrentRouterDist();
-			m_dynamicFib.addRoutingInfo(prefix, tempFaces, metric);
-			dataPacket.insertRelevantRouter(m_id,tempFaces, metric);
-		}
-		else// The Data packet has not been cached in previous nodes, and will be cached in later nodes. So 
-			// we set up a dynamic fib entry for it. 
+	/**
+	<@function. requeueInterestPacket
+	<@brief. Put an Interest packet woken up from the waiting Interest list back at the end of the Interest packet queue. If the
+		queue is full, the Interest packet is dropped, and so is the PIT entry it would have been forwarded again for.
+	*/
+	void requeueInterestPacket(InterestPacket interestPacket)
+	{
+		Name interestPacketName = interestPacket.getName();
+		if(m_interestList.isFull())
 		{
-			//cout << dataPacketName << " has not been cached in previous nodes, and will be cached in later nodes." << endl;
-			//cout << "Set up routing information for the Data packet " << dataPacketName << endl;
-			string prefix = trimLastComponentFromName(dataPacket.getName());
-			float metric = dataPacket.getCurrentRouterDist() - dataPacket.getCachingRouterDist();
-			vector<int> tempFaces;
-			for(list<int>::iterator iter(arrivalFaces.begin()), end(arrivalFaces.end());
-				iter != end; ++iter)
-				tempFaces.push_back(*iter);
-			vectorSubtraction(tempFaces, users);
-			m_dynamicFib.addRoutingInfo(prefix, tempFaces, metric);
-			dataPacket.insertRelevantRouter(m_id, tempFaces, metric);
+			++m_droppedInterestsNum;
+			abandonPitEntry(interestPacketName, interestPacket.getHopCount());
+			return;
 		}
-		interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		while(m_waitingInterestList.end() != interestIter)
+		bool isNack = InterestPacket::nack == interestPacket.getType();
+		int handle = interestPacketPool.allocate(move(interestPacket));
+		m_interestList.push_back(handle);
+		if(isNack)
+			m_nackInterests[interestPacketName].push_back(handle);
+	}
+
+	/**
+	<@function. abandonPitEntry
+	<@brief. Give up the PIT entry of a name whose Data packet will not come back, as the packet has been dropped. The waiting and
+		nack Interest packets of the name are dropped, and a nack Data packet is sent to every face in the PIT entry, so the nodes
+		downstream may try another face or give up in turn.
+	<@param. name, the name of the PIT entry.
+	<@param. hopCount, the hop count the nack Data packets are sent with.
+	*/
+	void abandonPitEntry(const Name& name, int hopCount)
+	{
+		dropWaitingInterestPackets(name);
+		cancelNackInterestPackets(name);
+		PitInfoList pitInfos;
+		m_pit.extractPitInfos(name, pitInfos);
+		for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
+			iter != end; ++iter)
 		{
-			m_waitingInterestList.erase(interestIter);
-			interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
+			DataPacket nackDataPacket(name);
+			nackDataPacket.setType(DataPacket::nack);
+			nackDataPacket.setHopCount(hopCount);
+			nackDataPacket.setArrivalFace(m_id);
+			nackDataPacket.setId(iter->m_interestPacketId);
+			nodes[iter->m_arrivalFace].pendDataPacket(nackDataPacket);
 		}
-		while(true)
+	}
+
+	/**
+	<@function. addWaitingInterestPacket
+	<@brief. Put an Interest packet that has been forwarded into the waiting Interest list, behind the waiting Interest packets
+		of the same name.
+	*/
+	void addWaitingInterestPacket(InterestPacket interestPacket)
+	{
+		Name interestPacketName = interestPacket.getName();
+		m_waitingInterests[interestPacketName].push_back(move(interestPacket));
+		++m_waitingInterestsNum;
+	}
+
+	/**
+	<@function. takeWaitingInterestPacket
+	<@brief. Take the earliest waiting Interest packet of a given name out of the waiting Interest list.
+	<@param. name, the name of the Interest packet.
+	<@param. interestPacket, a reference variable, the Interest packet will be moved into it.
+	<@return. If there is no waiting Interest packet of the name, the function returns false.
+	*/
+	bool takeWaitingInterestPacket(const Name& name, InterestPacket& interestPacket)
+	{
+		unordered_map<Name, vector<InterestPacket>, NameHash>::iterator iter = m_waitingInterests.find(name);
+		if(m_waitingInterests.end() == iter)
+			return false;
+		interestPacket = move(iter->second.front());
+		if(1 == iter->second.size())
+			m_waitingInterests.erase(iter);
+		else iter->second.erase(iter->second.begin());
+		--m_waitingInterestsNum;
+		return true;
+	}
+
+	/**
+	<@function. dropWaitingInterestPackets
+	<@brief. Drop all the waiting Interest packets of a given name, once the Data packet they asked for has come back.
+	*/
+	void dropWaitingInterestPackets(const Name& name)
+	{
+		unordered_map<Name, vector<InterestPacket>, NameHash>::iterator iter = m_waitingInterests.find(name);
+		if(m_waitingInterests.end() == iter)
+			return;
+		m_waitingInterestsNum -= iter->second.size();
+		m_waitingInterests.erase(iter);
+	}
+
+	/**
+	<@function. cancelNackInterestPackets
+	<@brief. Cancel the nack Interest packets of a given name in the Interest packet queue, once the Data packet they asked for
+		has come back. A cancelled Interest packet is turned into an unknow one in the Interest packet pool, and is dropped when
+		it reaches the front of the queue, so the queue is not scanned.
+	*/
+	void cancelNackInterestPackets(const Name& name)
+	{
+		unordered_map<Name, vector<int>, NameHash>::iterator iter = m_nackInterests.find(name);
+		if(m_nackInterests.end() == iter)
+			return;
+		for(vector<int>::iterator handleIter(iter->second.begin()), end(iter->second.end());
+			handleIter != end; ++handleIter)
 		{
-			bool flag = false;
-			for(list<InterestPacket>::iterator intIter(m_interestList.begin()), intEnd(m_interestList.end());
-				intIter != intEnd; ++intIter)
-			{
-				if(*intIter == interestPacket && InterestPacket::nack == intIter->getType())
-				{
-					//cout << "Erase an Interest packet from the Interest list." << endl;
-					//intIter->print();
-					m_interestList.erase(intIter);
-					flag = true;
-					break;
-				}
-			}
-			if(false == flag) break;
+			interestPacketPool.at(*handleIter).setType(InterestPacket::unknow);
+			++m_cancelledInterestsNum;
 		}
-		
-		//if(arrivalFaces.empty()) 
-		//	cout << "There is no pit entry to forward Data packet " << dataPacket.getName() << endl;
-		
-		for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
-			iter != end; ++iter)
+		m_nackInterests.erase(iter);
+	}
+
+	/**
+	<@function. forgetNackInterestPacket
+	<@brief. Remove a nack Interest packet taken from the front of the Interest packet queue from the index of the nack Interest packets.
+	<@param. name, the name of the Interest packet.
+	<@param. handle, the handle the Interest packet had in the Interest packet pool.
+	*/
+	void forgetNackInterestPacket(const Name& name, int handle)
+	{
+		unordered_map<Name, vector<int>, NameHash>::iterator iter = m_nackInterests.find(name);
+		if(m_nackInterests.end() == iter)
+			return;
+		vector<int>& handles = iter->second;
+		vector<int>::iterator handleIter = find(handles.begin(), handles.end(), handle);
+		if(handles.end() == handleIter)
+			return;
+		handles.erase(handleIter);
+		if(handles.empty())
+			m_nackInterests.erase(iter);
+	}
+
+	/**
+	<@function. deliverDataPacket
+	<@brief. Put an arrived Data packet into the Data packet queue of the node. If the queue is full, the Data packet is dropped,
+		and the node gives up the Interest packets it answers: an end user drops its unmet Interest packet, and a router its PIT
+		entry. The nack Data packets are never dropped, as they are what tells the nodes downstream to clean up.
+	<@param. dataPacket, the handle of the Data packet in the Data packet pool.
+	*/
+	void deliverDataPacket(int dataPacket)
+	{
+		if(m_dataList.isFull() && DataPacket::nack != dataPacketPool.at(dataPacket).getType())
 		{
-			DataPacket tempDataPacket(dataPacket);
-			tempDataPacket.setId(iter->m_interestPacketId);
-			nodes[iter->m_arrivalFace].pendDataPacket(tempDataPacket);
-			if(tempDataPacket.getId() >= lowerPacketNumLimit && tempDataPacket.getId() <= upperPacketNumLimit)
-			{
-				++measuredHopNum;
-			}
-			//cout << "normal Data " << dataPacket.getName() << " router " << m_id << "--->" << iter->m_arrivalFace << endl;
+			DataPacket droppedDataPacket(dataPacketPool.take(dataPacket));
+			++m_droppedDataNum;
+			if(user == m_type)
+				m_unmetInterests.dropInterest(droppedDataPacket.getName(), droppedDataPacket.getId());
+			else abandonPitEntry(droppedDataPacket.getName(), droppedDataPacket.getHopCount());
 		}
+		else m_dataList.push_back(dataPacket);
+		scheduler.activate(m_id);
 	}
-*/
+	
+	/**
+	<@function. processNormalDataPacket
+	<@brief. When the Data packet to be processed is a normal Data packet, call the function.
+	<@param. dataPacket, the Data packet to be processed.
+	*/
 	void processNormalDataPacket(DataPacket dataPacket)
 	{
-		string dataPacketName = dataPacket.getName();
+		Name dataPacketName = dataPacket.getName();
 		InterestPacket interestPacket(dataPacketName);
-		list<InterestPacket>::iterator interestIter;
 		int arrivalFace = dataPacket.getArrivalFace();
 		
 		dataPacket.setArrivalFace(m_id);
 		dataPacket.increaseHopCount();
 
 		list<int> arrivalFaces;
-		list<PitInfo> pitInfos;
-		m_pit.getPitInfos(dataPacketName, pitInfos);
-		m_pit.dropEntry(dataPacketName);
-		for(list<PitInfo>::iterator pitInfoIter(pitInfos.begin()), pitInfoEnd(pitInfos.end());
+		PitInfoList pitInfos;
+		m_pit.extractPitInfos(dataPacketName, pitInfos);
+		for(PitInfoList::iterator pitInfoIter(pitInfos.begin()), pitInfoEnd(pitInfos.end());
 			pitInfoIter != pitInfoEnd; ++pitInfoIter)
 		{
 			arrivalFaces.push_back(pitInfoIter->m_arrivalFace);
@@ -322,7 +463,7 @@ class Node
 			cacheDataPacket(dataPacket);	
 			dataPacket.clearRelevantRouters();
 			dataPacket.setCachingRouterId(m_id);
-			for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
+			for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
 				iter != end; ++iter)
 			{
 				DataPacket tempDataPacket(dataPacket);
@@ -341,11 +482,11 @@ class Node
 			//cout << "Set up dynamic routing information for the Data packet " << dataPacketName << endl;
 			vector<int> tempFaces;
 			tempFaces.push_back(arrivalFace);
-			string prefix = trimLastComponentFromName(dataPacket.getName());
+			int fileId = dataPacket.getName().fileId;
 			float metric = dataPacket.getCachingRouterDist() - dataPacket.getCurrentRouterDist();
-			m_dynamicFib.addRoutingInfo(prefix, tempFaces, metric);
+			m_dynamicFib.addRoutingInfo(fileId, tempFaces, metric);
 			dataPacket.insertRelevantRouter(m_id,tempFaces, metric);
-			for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
+			for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
 				iter != end; ++iter)
 			{
 				DataPacket tempDataPacket(dataPacket);
@@ -364,16 +505,16 @@ class Node
 		{
 			//cout << dataPacketName << " has not been cached in previous nodes, and will be cached in later nodes." << endl;
 			//cout << "Set up routing information for the Data packet " << dataPacketName << endl;
-			string prefix = trimLastComponentFromName(dataPacket.getName());
+			int fileId = dataPacket.getName().fileId;
 			float metric = dataPacket.getCurrentRouterDist() - dataPacket.getCachingRouterDist();
 			vector<int> tempFaces;
-			for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
+			for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
 				iter != end; ++iter)
 			{
 				tempFaces.clear();
 				tempFaces.push_back(iter->m_arrivalFace);
 				//vectorSubtraction(tempFaces, users);
-				m_dynamicFib.addRoutingInfo(prefix, tempFaces, metric);
+				m_dynamicFib.addRoutingInfo(fileId, tempFaces, metric);
 				DataPacket tempDataPacket(dataPacket);
 				tempDataPacket.setId(iter->m_interestPacketId);
 				tempDataPacket.insertRelevantRouter(m_id, tempFaces, metric);
@@ -384,34 +525,13 @@ class Node
 				}
 			}
 		}
-		interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		while(m_waitingInterestList.end() != interestIter)
-		{
-			m_waitingInterestList.erase(interestIter);
-			interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		}
-		while(true)
-		{
-			bool flag = false;
-			for(list<InterestPacket>::iterator intIter(m_interestList.begin()), intEnd(m_interestList.end());
-				intIter != intEnd; ++intIter)
-			{
-				if(*intIter == interestPacket && InterestPacket::nack == intIter->getType())
-				{
-					//cout << "Erase an Interest packet from the Interest list." << endl;
-					//intIter->print();
-					m_interestList.erase(intIter);
-					flag = true;
-					break;
-				}
-			}
-			if(false == flag) break;
-		}
+		dropWaitingInterestPackets(interestPacket.getName());
+		cancelNackInterestPackets(interestPacket.getName());
 		
 		//if(arrivalFaces.empty()) 
 		//	cout << "There is no pit entry to forward Data packet " << dataPacket.getName() << endl;
 		
-		//for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
+		//for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
 		//	iter != end; ++iter)
 		//{
 		//	DataPacket tempDataPacket(dataPacket);
@@ -433,19 +553,17 @@ class Node
 	*/
 	void processNocacheDataPacket(DataPacket dataPacket)
 	{
-		string dataPacketName = dataPacket.getName();
+		Name dataPacketName = dataPacket.getName();
 		InterestPacket interestPacket(dataPacketName);
-		list<InterestPacket>::iterator interestIter;
 		int arrivalFace = dataPacket.getArrivalFace();
 		
 		dataPacket.setArrivalFace(m_id);
 		dataPacket.increaseHopCount();
 
 		list<int> arrivalFaces;
-		list<PitInfo> pitInfos;
-		m_pit.getPitInfos(dataPacketName, pitInfos);
-		m_pit.dropEntry(dataPacketName);
-		for(list<PitInfo>::iterator pitInfoIter(pitInfos.begin()), pitInfoEnd(pitInfos.end());
+		PitInfoList pitInfos;
+		m_pit.extractPitInfos(dataPacketName, pitInfos);
+		for(PitInfoList::iterator pitInfoIter(pitInfos.begin()), pitInfoEnd(pitInfos.end());
 			pitInfoIter != pitInfoEnd; ++pitInfoIter)
 		{
 			arrivalFaces.push_back(pitInfoIter->m_arrivalFace);
@@ -453,32 +571,13 @@ class Node
 		
 		//cout << "nocache Data " << dataPacketName << " router " << m_id << "<---" << dataPacket.getArrivalFace() << endl;
 
-		interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		while(m_waitingInterestList.end() != interestIter)
-		{
-			m_waitingInterestList.erase(interestIter);
-			interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		}
-		while(true)
-		{
-			bool flag = false;
-			for(list<InterestPacket>::iterator intIter(m_interestList.begin()), intEnd(m_interestList.end());
-				intIter != intEnd; ++intIter)
-			{
-				if(*intIter == interestPacket && InterestPacket::nack == intIter->getType())
-				{
-					m_interestList.erase(intIter);
-					flag = true;
-					break;
-				}
-			}
-			if(false == flag) break;
-		}
+		dropWaitingInterestPackets(interestPacket.getName());
+		cancelNackInterestPackets(interestPacket.getName());
 		
 		//if(arrivalFaces.empty()) 
 		//	cout << "There is no pit entry to forward Data packet " << dataPacket.getName() << endl;
 		
-		for(list<PitInfo>::iterator iter(pitInfos.begin()), end(pitInfos.end());
+		for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
 			iter != end; ++iter)
 		{
 			DataPacket tempDataPacket(dataPacket);
@@ -499,24 +598,23 @@ class Node
 	*/
 	void processNackDataPacket(DataPacket dataPacket)
 	{
-		string dataPacketName = dataPacket.getName();
+		Name dataPacketName = dataPacket.getName();
 		InterestPacket interestPacket(dataPacketName);
-		list<InterestPacket>::iterator interestIter;
 		int arrivalFace = dataPacket.getArrivalFace();
 		
 		// This is a NACK packet. The relevant Interest packet will be waked up.
 		//cout << "nack Data " << dataPacketName << " router " << m_id << "<---" << dataPacket.getArrivalFace() << endl;
-		interestIter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-		if(m_waitingInterestList.end() != interestIter)
+		if(takeWaitingInterestPacket(dataPacketName, interestPacket))
 		{
 			//cout << "Wake up an Interest packet " << dataPacketName << " from the waiting Interest list." << endl;
-			interestIter->setType(InterestPacket::nack);
-			interestIter->setHopCount(dataPacket.getHopCount() + 1);
-			//cout << "before assigning" << endl;
-			interestPacket = *interestIter;
-			//cout << "after assigning" << endl;
-			m_waitingInterestList.erase(interestIter);
-			m_interestList.push_back(interestPacket);
+			interestPacket.setType(InterestPacket::nack);
+			interestPacket.setHopCount(dataPacket.getHopCount() + 1);
+			requeueInterestPacket(move(interestPacket));
+		}
+		else if(m_nackInterests.end() == m_nackInterests.find(dataPacketName) && arrivalFace == m_pit.getForwardingFace(dataPacketName))
+		{// There is no Interest packet of the name left to forward again, so the PIT entry is given up. A stale nack Data packet, for
+			// an entry since satisfied and set up anew through another face, leaves the new entry alone.
+			abandonPitEntry(dataPacketName, dataPacket.getHopCount() + 1);
 		}
 	}
 
@@ -532,97 +630,197 @@ class Node
 	{
 		while(!m_dataList.empty())
 		{
-			DataPacket dataPacket(m_dataList.front());
-			m_dataList.pop_front(); 
-			if(dataPacket.getType() == DataPacket::normal)
-				processNormalDataPacket(dataPacket);
-			else if(dataPacket.getType() == DataPacket::nocache)
-				processNocacheDataPacket(dataPacket);
-			else if(dataPacket.getType() == DataPacket::nack)
-				processNackDataPacket(dataPacket);
+			DataPacket dataPacket(dataPacketPool.take(m_dataList.front()));
+			m_dataList.pop_front();
+			processDataPacket(move(dataPacket), RoutingPolicy());
 		}
 	}
-	
+
+	/**
+	<@function. processDataPacket
+	<@brief. Process a Data packet under the dynamic routing, setting up the dynamic routing information for it.
+	<@param. dataPacket, the Data packet to be processed.
+	*/
+	void processDataPacket(DataPacket dataPacket, DynamicRouting)
+	{
+		if(dataPacket.getType() == DataPacket::normal)
+			processNormalDataPacket(move(dataPacket));
+		else if(dataPacket.getType() == DataPacket::nocache)
+			processNocacheDataPacket(move(dataPacket));
+		else if(dataPacket.getType() == DataPacket::nack)
+			processNackDataPacket(move(dataPacket));
+	}
+
+	/**
+	<@function. processDataPacket
+	<@brief. Process a Data packet under the static routing. The router caches a normal Data packet as its caching policy decides, and
+		forwards any Data packet along the PIT entry, without setting up any routing information for it.
+	<@param. dataPacket, the Data packet to be processed.
+	*/
+	void processDataPacket(DataPacket dataPacket, StaticRouting)
+	{
+		Name dataPacketName = dataPacket.getName();
+		//cout << "Data " << dataPacketName << " router " << m_id << "<---" << dataPacket.getArrivalFace() << endl;
+		// A nack Data packet, sent back for an Interest packet dropped at a full queue, carries no content and is only forwarded.
+		if(DataPacket::normal == dataPacket.getType())
+			admitDataPacket(dataPacket, CachePolicy());
+
+		dataPacket.setArrivalFace(m_id);
+		dataPacket.increaseHopCount();
+		PitInfoList pitInfos;
+		m_pit.extractPitInfos(dataPacketName, pitInfos);
+		//if(pitInfos.empty())
+		//	cout << "There is no pit entry to forward Data packet " << dataPacket.getName() << endl;
+		for(PitInfoList::iterator iter(pitInfos.begin()), end(pitInfos.end());
+			iter != end; ++iter)
+		{
+			DataPacket tempDataPacket(dataPacket);
+			tempDataPacket.setId(iter->m_interestPacketId);
+			nodes[iter->m_arrivalFace].pendDataPacket(tempDataPacket);
+			if(tempDataPacket.getId() >= lowerPacketNumLimit && tempDataPacket.getId() <= upperPacketNumLimit)
+			{
+				++measuredHopNum;
+			}
+			//cout << "Data " << dataPacket.getName() << " router " << m_id << "--->" << iter->m_arrivalFace << endl;
+		}
+	}
+
 	/**
-	<@function. processDataPacketStatic
-	<@brief. The function is used when dynamic routing is not considered. When a router receives a 
-		Data packet, it will forward cache it (in case the router should cache the Data packet 
-		according to our caching strategy) and forward it without setting up dynamic routing information
-		for it.
-	*/
-	//void processDataPacketStatic()
-	//{
-	//	while(!m_dataList.empty())
-	//	{
-	//		//cout << "Router" << m_id << " enters processDataPacket()" << endl;
-	//		DataPacket dataPacket(m_dataList.front());
-	//		dataPacket.increaseHopCount();
-	//		cout << "Data " << dataPacket.getName() << " router " << m_id << "<---" << dataPacket.getArrivalFace() << endl;
-	//		cout << "dataPacket.hopSum = " << dataPacket.getHopCount() << endl;
-	//		m_dataList.pop_front(); 
-	//		//dataPacket.increaseHopCount();
-	//		string dataPacketName = dataPacket.getName();
-	//		dataPacket.setArrivalFace(m_id);
-	//		dataPacket.decreaseCurrentRouterDist();
-
-	//		// Determine the router will cache it or set up routing information for it, and modify the relevant router list accordingly.
-	//		if(dataPacket.getCurrentRouterDist() == dataPacket.getCachingRouterDist())
-	//		{//if the currentRouterDist value is equal to the cachingRouterDist value, or there is nowhere to forward the Interest packet,
-	//			// or there is only one next node and the node is a user node, cache the Data packet.
-	//			cacheDataPacket(dataPacket);	
-	////			cout << "after caching." << endl;
-	//		}
-
-	//		list<int> arrivalFaces;
-	//		m_pit.getArrivalFaces(dataPacketName, arrivalFaces);
-	////		cout << "before drop()" << endl;
-	//		m_pit.dropEntry(dataPacketName);
-	//		
-	//		if(arrivalFaces.empty()) 
-	//			cout << "There is no pit entry to forward Data packet " << dataPacket.getName() << endl;
-
-	//		for(list<int>::iterator iter(arrivalFaces.begin()), end(arrivalFaces.end());
-	//			iter != end; ++iter)
-	//		{
-	//			nodes[*iter].pendDataPacket(dataPacket);
-	//			cout << "Data " << dataPacket.getName() << " router " << m_id << "--->" << *iter << endl;
-	//		}
-	//	}
-	//}
+	<@function. admitDataPacket
+	<@brief. Under the selective caching, a router caches a normal Data packet passing by if it is the caching router elected by the
+		Interest packet, i.e., if the currentRouterDist value is equal to the cachingRouterDist value. A nocache Data packet is not cached.
+	<@param. dataPacket, a reference variable, the Data packet passing by.
+	*/
+	void admitDataPacket(DataPacket& dataPacket, SelectiveCaching)
+	{
+		if(DataPacket::normal != dataPacket.getType())
+			return;
+		dataPacket.decreaseCurrentRouterDist();
+		if(dataPacket.getCurrentRouterDist() == dataPacket.getCachingRouterDist())
+		{
+			//cout << "Cache the Data packet " << dataPacket.getName() << endl;
+			cacheDataPacket(dataPacket);
+			dataPacket.clearRelevantRouters();
+			dataPacket.setCachingRouterId(m_id);
+		}
+	}
+
+	/**
+	<@function. admitDataPacket
+	<@brief. Under the on-path caching, a router caches every Data packet passing by that its caching policy admits.
+	<@param. dataPacket, a reference variable, the Data packet passing by.
+	*/
+	void admitDataPacket(DataPacket& dataPacket, OnPathCaching)
+	{
+		if(CachePolicy::admits(m_random))
+		{
+			m_contentStore.admitDataPacket(dataPacket, CachePolicy::cachesAtFront);
+			++m_cachedDataPacketsNum;
+		}
+	}
+
+	/**
+	<@function. enableCacheAdmission
+	<@brief. Under the selective caching, the elected router caches a Data packet unconditionally, so there is no admission filter.
+	*/
+	void enableCacheAdmission(SelectiveCaching)
+	{
+	}
 
+	/**
+	<@function. enableCacheAdmission
+	<@brief. Under the on-path caching, the content store passes the Data packets cached on the path through its admission filter
+		if cacheAdmission is set.
+	*/
+	void enableCacheAdmission(OnPathCaching)
+	{
+		if(cacheAdmission)
+			m_contentStore.enableAdmission();
+	}
 
 	/**
 	<@function. processNormalInterestPacket
-	<@brief. When the Interest packet to be processed is a normal Interest packet, call the function.
+	<@brief. When the Interest packet to be processed is a normal Interest packet, call the function. Under the static routing, the
+		Interest packet is forwarded through the static FIB, and the distance to the router is counted as it arrives.
 	<@param. interestPacket, the Interest packet to be processed.
+	<@param. hashValue, the hash value the router bids with in the election of the caching router of the Interest packet.
 	*/
-	void processNormalInterestPacket(InterestPacket interestPacket)
+	void processNormalInterestPacket(InterestPacket interestPacket, float hashValue, StaticRouting)
 	{
-		string interestPacketName = interestPacket.getName();
-		string trimedName = trimLastComponentFromName(interestPacketName);
+		Name interestPacketName = interestPacket.getName();
 		int arrivalFace = interestPacket.getArrivalFace();
 		//cout << "normal Interest " << interestPacketName << " router " << m_id << "<---" << arrivalFace << endl;
 		interestPacket.increaseHopCount();
+		interestPacket.increaseCurrentRouterDist();
 		pair<bool, DataPacket> tempPair = m_contentStore.getDataPacket(interestPacketName);
 		if(true == tempPair.first)	//The node can supply the requested Data packet.
 		{
 			//cout << "Caching hit!" << endl;
 			DataPacket returnDataPacket(tempPair.second);
-			returnDataPacket.setCurrentRouterDist(interestPacket.getCurrentRouterDist() + 1);
-			returnDataPacket.setCachingRouterDist(interestPacket.getCachingRouterDist());
+			tagReturnDataPacket(returnDataPacket, interestPacket.getCurrentRouterDist(), interestPacket.getCachingRouterDist(), CachePolicy());
 			returnDataPacket.setArrivalFace(m_id);
 			returnDataPacket.setHopCount(interestPacket.getHopCount());
 			returnDataPacket.clearRelevantRouters();
-			float currentRouterDist = float(returnDataPacket.getCurrentRouterDist());
-			float cachingRouterDist = float(returnDataPacket.getCachingRouterDist());
-			if(currentRouterDist - cachingRouterDist > cacheThreshold && cachingRouterDist/currentRouterDist < 0.618)	// I choose the gold ratio as the 
-			{																	// criterion; I don't know why, but I believe it will work well.
-				returnDataPacket.setType(DataPacket::normal);
+			returnDataPacket.setId(interestPacket.getId());
+			nodes[arrivalFace].pendDataPacket(returnDataPacket);
+			if(returnDataPacket.getId() >= lowerPacketNumLimit & returnDataPacket.getId() <= upperPacketNumLimit)
+			{
+				++measuredHopNum;
 			}
-			else
+			//cout << "Data " << returnDataPacket.getName() << " router " << m_id << "--->" << arrivalFace << endl;
+			return;
+		}
+		// The node cannot supply the requested Data packet.
+		//If there is a matching PIT entry for the Interest packet, add the Interest packet to the pit entry simply.
+		if(m_pit.matchingEntryExists(interestPacketName))
+		{
+			m_pit.insertEntry(interestPacketName, arrivalFace, interestPacket.getHopCount(), 
+				interestPacket.getCurrentRouterDist(), interestPacket.getId());
+			//cout << "Add the Interest " << interestPacketName << " into the PIT entry" << endl;
+		}
+		else// There is no matching PIT entry to forward the Interest packet, forward the Interest packet towards 
+			//the producer of the requested Data packet.
+		{
+			int prefixId = nameTable.getFilePrefixId(interestPacketName.fileId);
+			bool doesExist;
+			int staticFace;
+			float staticMetric;
+			m_staticFib.query(prefixId, doesExist, staticFace, staticMetric); //attention. In the model we don't consider
+			electCachingRouter(interestPacket, hashValue, CachePolicy());
+			interestPacket.setArrivalFace(m_id);
+			nodes[staticFace].pendInterestPacket(interestPacket);
+			if(interestPacket.getId() >= lowerPacketNumLimit && interestPacket.getId() <= upperPacketNumLimit)
 			{
-				returnDataPacket.setType(DataPacket::nocache);
+				++measuredHopNum;
 			}
+			//cout << "Interest " << interestPacket.getName() << " router " << m_id << "--->" << staticFace << endl;
+			m_pit.insertEntry(interestPacketName, arrivalFace, interestPacket.getHopCount(), interestPacket.getCurrentRouterDist(), 
+				interestPacket.getId(), staticFace); 
+		}//End: There is no matching PIT entry to forward the Interest packet.
+	}
+
+	/**
+	<@function. processNormalInterestPacket
+	<@brief. When the Interest packet to be processed is a normal Interest packet, call the function. Under the dynamic routing, the
+		Interest packet is forwarded through the cheapest available face, and the distance to the router it is forwarded to is counted.
+	<@param. interestPacket, the Interest packet to be processed.
+	<@param. hashValue, the hash value the router bids with in the election of the caching router of the Interest packet.
+	*/
+	void processNormalInterestPacket(InterestPacket interestPacket, float hashValue, DynamicRouting)
+	{
+		Name interestPacketName = interestPacket.getName();
+		int arrivalFace = interestPacket.getArrivalFace();
+		//cout << "normal Interest " << interestPacketName << " router " << m_id << "<---" << arrivalFace << endl;
+		interestPacket.increaseHopCount();
+		pair<bool, DataPacket> tempPair = m_contentStore.getDataPacket(interestPacketName);
+		if(true == tempPair.first)	//The node can supply the requested Data packet.
+		{
+			//cout << "Caching hit!" << endl;
+			DataPacket returnDataPacket(tempPair.second);
+			tagReturnDataPacket(returnDataPacket, interestPacket.getCurrentRouterDist() + 1, interestPacket.getCachingRouterDist(), CachePolicy());
+			returnDataPacket.setArrivalFace(m_id);
+			returnDataPacket.setHopCount(interestPacket.getHopCount());
+			returnDataPacket.clearRelevantRouters();
 			returnDataPacket.setId(interestPacket.getId());
 			nodes[arrivalFace].pendDataPacket(returnDataPacket);
 			if(returnDataPacket.getId() >= lowerPacketNumLimit & returnDataPacket.getId() <= upperPacketNumLimit)
@@ -657,14 +855,11 @@ class Node
 					// we will send a copy to that child router. The child router don't need to do anything, as the face is the only face the child router could choose.
 					m_pit.insertEntry(interestPacketName, arrivalFace, interestPacket.getHopCount(), 
 						interestPacket.getCurrentRouterDist() + 1, interestPacket.getId());
-					list<InterestPacket>::iterator iter = find(m_waitingInterestList.begin(), m_waitingInterestList.end(), interestPacket);
-					if(m_waitingInterestList.end() != iter)
+					if(takeWaitingInterestPacket(interestPacketName, interestPacket))
 					{// Actually we should always find a matching Interest packet in waiting list; but in case we failed to find the 
 						// matching Interest, we add the judgement statement.
-						interestPacket = *iter;
-						m_waitingInterestList.erase(iter);
 						interestPacket.setType(InterestPacket::nack);
-						m_interestList.push_back(interestPacket);
+						requeueInterestPacket(move(interestPacket));
 						//cout << "And the forwarding face is not the face towarding the producer." << endl;
 						//cout << "Wake up the Interest packet from the waiting list" << endl;
 					}
@@ -686,8 +881,7 @@ class Node
 		}
 		else// There is no matching PIT entry to forward the Interest packet.
 		{
-			set<int> unavailableFaces;
-			interestPacket.getUnavailableFaces(unavailableFaces);
+			const set<int>& unavailableFaces = interestPacket.getUnavailableFaces();
 			int resultantFace;
 			// Check if there are available faces.
 			getAvailableFace(interestPacketName, unavailableFaces, resultantFace);
@@ -709,34 +903,7 @@ class Node
 			{
 				interestPacket.insertUnavailableFace(resultantFace);
 				interestPacket.increaseCurrentRouterDist();
-				float hashValue1 = interestPacket.getHashValue();
-				float weight1 = interestPacket.getWeight();
-				//Combined the node's identifier and the file name part of the Interest packet's name into a new string.
-				string combinedString = generateRandomString(m_id, 10);
-				//cout << "Combined String: " << combinedString << endl;
-				combinedString = combinedString + trimedName;
-				float hashValue2 = hashStringToNum(combinedString);
-				float weight2 = m_weight;
-				float alpha1, alpha2;
-				//For the logic of the following code, please refer to our paper "'Do My Best' Routing in Named Data Networking".
-				if(weight1 < weight2)
-				{
-					alpha1 = 2*weight1/(weight1 + weight2);
-					alpha2 = 1;
-				}
-				else
-				{
-					alpha1 = 1;
-					alpha2 = 2*weight2/(weight1 + weight2);
-				}
-				//if(alpha2*hashValue2 > alpha1*hashValue1)
-				if(hashValue2 > hashValue1)
-				{
-					//cout << "Update the weight, hash value and caching router value." << endl;
-					interestPacket.setCachingRouterDist(interestPacket.getCurrentRouterDist());
-					interestPacket.setWeight(weight2);
-					interestPacket.setHashValue(hashValue2);
-				}
+				electCachingRouter(interestPacket, hashValue, CachePolicy());
 				//interestPacket.setArrivalFace(m_id);
 				InterestPacket tempInterestPacket(interestPacket);
 				tempInterestPacket.setArrivalFace(m_id);
@@ -749,7 +916,7 @@ class Node
 				//cout << "Interest " << interestPacket.getName() << " router " << m_id << "--->" << resultantFace << endl;
 				m_pit.insertEntry(interestPacketName, arrivalFace, interestPacket.getHopCount(), interestPacket.getCurrentRouterDist(), 
 					interestPacket.getId(), resultantFace); 
-				m_waitingInterestList.push_back(interestPacket);
+				addWaitingInterestPacket(move(interestPacket));
 			}//End: There is an available face to forward the Interest packet. Forward it.
 		}//End: There is no matching PIT entry to forward the Interest packet.
 		//cout << "leave if" << endl;
@@ -762,8 +929,7 @@ class Node
 	*/
 	void processNackInterestPacket(InterestPacket interestPacket)
 	{		
-		string interestPacketName = interestPacket.getName();
-		string trimedName = trimLastComponentFromName(interestPacketName);
+		Name interestPacketName = interestPacket.getName();
 		int arrivalFace = interestPacket.getArrivalFace();
 		//cout << "nack Interest " << interestPacketName << " router " << m_id << "<---" << arrivalFace << endl;
 		//Check if the router could supply the requested Data packet.
@@ -772,20 +938,9 @@ class Node
 		{
 			//cout << "Caching hit!" << endl;			
 			DataPacket returnDataPacket(tempPair.second);
-			returnDataPacket.setCurrentRouterDist(interestPacket.getCurrentRouterDist());
-			returnDataPacket.setCachingRouterDist(interestPacket.getCachingRouterDist());
+			tagReturnDataPacket(returnDataPacket, interestPacket.getCurrentRouterDist(), interestPacket.getCachingRouterDist(), CachePolicy());
 			returnDataPacket.setArrivalFace(m_id);
 			returnDataPacket.setHopCount(interestPacket.getHopCount());
-			float currentRouterDist = float(returnDataPacket.getCurrentRouterDist());
-			float cachingRouterDist = float(returnDataPacket.getCachingRouterDist());
-			if(currentRouterDist - cachingRouterDist > cacheThreshold && cachingRouterDist/currentRouterDist < 0.618)	// I choose the gold ratio as the 
-			{																	// criterion; I don't know why, but I believe it will work well.
-				returnDataPacket.setType(DataPacket::normal);
-			}
-			else
-			{
-				returnDataPacket.setType(DataPacket::nocache);
-			}
 			returnDataPacket.setId(interestPacket.getId());
 			if(returnDataPacket.getId() >= lowerPacketNumLimit && returnDataPacket.getId() <= upperPacketNumLimit)
 			{
@@ -797,8 +952,7 @@ class Node
 		}
 		//The router could not supply the requested Data packet.
 		//Consider forwarding the Interest packet.
-		set<int> unavailableFaces;
-		interestPacket.getUnavailableFaces(unavailableFaces);
+		const set<int>& unavailableFaces = interestPacket.getUnavailableFaces();
 		int resultantFace;
 		// Check if there are available faces.
 		getAvailableFace(interestPacketName, unavailableFaces, resultantFace);
@@ -829,7 +983,7 @@ class Node
 			{
 				++measuredHopNum;
 			}
-			m_waitingInterestList.push_back(interestPacket);
+			addWaitingInterestPacket(move(interestPacket));
 			m_pit.setForwardingFace(interestPacketName, resultantFace);
 			//cout << "Interest " << interestPacket.getName() << " router " << m_id << "--->" << resultantFace << endl;
 		}
@@ -841,111 +995,111 @@ class Node
 	{		
 		while(!m_interestList.empty())
 		{
-			InterestPacket interestPacket = m_interestList.front();
-			m_interestList.pop_front();			
-			if(InterestPacket::normal == interestPacket.getType())
+			//Score the Interest packets queued up so far in a batch, before any of them is processed.
+			int interestPacketsNum = m_interestList.size();
+			scoreInterestPackets(CachePolicy());
+			int normalNum = 0;
+			for(int i = 0; i < interestPacketsNum; ++i)
 			{
-				processNormalInterestPacket(interestPacket);
-			}
-			else if(InterestPacket::nack == interestPacket.getType())
-			{
-				processNackInterestPacket(interestPacket);
+				int handle = m_interestList.front();
+				m_interestList.pop_front();
+				InterestPacket interestPacket(interestPacketPool.take(handle));
+				if(InterestPacket::normal == interestPacket.getType())
+				{
+					processNormalInterestPacket(move(interestPacket), m_batchHashValues[normalNum++], RoutingPolicy());
+				}
+				else if(InterestPacket::nack == interestPacket.getType())
+				{
+					forgetNackInterestPacket(interestPacket.getName(), handle);
+					processNackInterestPacket(move(interestPacket));
+				}
+				else
+				{// A nack Interest packet cancelled by cancelNackInterestPackets.
+					--m_cancelledInterestsNum;
+				}
 			}
 		}// End while
 	}
 
 	/**
-	<@function. processInterestPacketStatic
-	<@brief. The function is used when we don't consider the dynamic routing, i.e., every Interest packet will be forwarded 
-		to the producer of requested Data packet. When the Interest packet pass across a router and the router happens to be able
-		to supply the requested Data packet, the Interest packet will be consumed and the Data packet will be fetched back from the 
-		router.
-	*/
-	//void processInterestPacketStatic()
-	//{
-	//	while(!m_interestList.empty())
-	//	{
-	//		InterestPacket interestPacket = m_interestList.front();
-	//		m_interestList.pop_front();
-	//		string interestPacketName = interestPacket.getName();
-	//		//cout << "interestPacketName = " << interestPacketName << endl;
-	//		string trimedName = trimLastComponentFromName(interestPacketName);
-	//		//cout << "interestPacketName = " << interestPacketName << endl;
-	//		int arrivalFace = interestPacket.getArrivalFace();
-	//		//cout << "here" << endl;
-	//		//if(InterestPacket::normal == interestPacket.getType() )
-	//		//{
-	//	//	cout << "enter if" << endl;
-	//		//cout << "normal Interest:" << endl;
-	//		cout << "Interest " << interestPacketName << " router " << m_id << "<---" << arrivalFace << endl;
-	//		interestPacket.increaseHopCount();
-	//		cout << "interestPacket.hopSum = " << interestPacket.getHopCount() << endl;
-	//		interestPacket.increaseCurrentRouterDist();
-	//		interestPacket.setArrivalFace(m_id);
-	//		
-	//		// Check if there are matching Data packet in content store.
-	//		pair<bool, DataPacket> tempPair = m_contentStore.getDataPacket(interestPacketName);
-	//		if(true == tempPair.first)	//The node can supply the requested Data packet.
-	//		{
-	//			cout << "Caching hit!" << endl;
-	//			DataPacket returnDataPacket(tempPair.second);
-	//			returnDataPacket.setCurrentRouterDist(interestPacket.getCurrentRouterDist());
-	//			returnDataPacket.setCachingRouterDist(interestPacket.getCachingRouterDist());
-	//			returnDataPacket.setArrivalFace(m_id);
-	//			returnDataPacket.setHopCount(interestPacket.getHopCount());
-	//			//returnDataPacket.clearRelevantRouters();
-	//			nodes[arrivalFace].pendDataPacket(returnDataPacket);
-	//			//Data www.youtube.com/TKWoQOBjvg/nwbK7iXmgF/LTmfLBIE4A/100/99 user 23<---2
-	//			cout << "Data " << returnDataPacket.getName() << " router " << m_id << "--->" << arrivalFace << endl;
-	//			//cout << "after2" << endl;
-	//			continue;
-	//		}
-	//		// The node cannot supply the requested Data packet.
-	//		//If there is a matching PIT entry for the Interest packet.
-	//		if(m_pit.matchingEntryExists(interestPacketName))
-	//		{
-	//			m_pit.insertEntry(interestPacketName, arrivalFace, pitEntryLifetime);
-	//		}
-	//		else// There is no matching PIT entry to forward the Interest packet.
-	//		{
-	//			//interestPacket.increaseCurrentRouterDist();
-	//			//Extract the hash value and weight from the Interest packet.
-	//			float hashValue1 = interestPacket.getHashValue();
-	//			float weight1 = interestPacket.getWeight();
-	//			//Combined the node's identifier and the file name part of the Interest packet's name into a new string.
-	//			string combinedString = generateRandomString(m_id, 10);
-	//			combinedString = combinedString + trimedName;
-	//			float hashValue2 = hashStringToNum(combinedString);
-	//			float weight2 = m_weight;
-	//			float alpha1, alpha2;
-	//			//For the logic of the following code, please refer to our paper "'Do My Best' Routing in Named Data Networking".
-	//			if(weight1 < weight2)
-	//			{
-	//				alpha1 = 2*weight1/(weight1 + weight2);
-	//				alpha2 = 1;
-	//			}
-	//			else
-	//			{
-	//				alpha1 = 1;
-	//				alpha2 = 2*weight2/(weight1 + weight2);
-	//			}
-	//			if(alpha2*hashValue2 > alpha1*hashValue1)
-	//			{
-	//				interestPacket.setCachingRouterDist(interestPacket.getCurrentRouterDist());
-	//				interestPacket.setWeight(weight2);
-	//				interestPacket.setHashValue(hashValue2);
-	//			}
-	//			int staticFace;
-	//			float staticMetric;
-	//			bool flag;
-	//			getStaticRoutingInfo(interestPacketName, flag, staticFace, staticMetric);
-	//			nodes[staticFace].pendInterestPacket(interestPacket);
-	//			cout << "Interest " << interestPacket.getName() << " router " << m_id << "--->" << staticFace << endl;
-	//			m_pit.insertEntry(interestPacketName, arrivalFace, pitEntryLifetime);
-	//		}//End: There is no matching PIT entry to forward the Interest packet.
-	//	}// End while
-	//}
+	<@function. scoreInterestPackets
+	<@brief. Get the hash values the router bids with for the normal Interest packets in the Interest packet queue, into m_batchHashValues
+		in the order of the queue.
+	*/
+	void scoreInterestPackets(SelectiveCaching)
+	{
+		m_batchFileIds.clear();
+		for(int position = 0; position < m_interestList.size(); ++position)
+		{
+			const InterestPacket& interestPacket = interestPacketPool.at(m_interestList.at(position));
+			if(InterestPacket::normal == interestPacket.getType())
+				m_batchFileIds.push_back(interestPacket.getName().fileId);
+		}
+		m_batchHashValues.resize(m_batchFileIds.size());
+		if(!m_batchFileIds.empty())
+			cachingHash.hash(m_id, &m_batchFileIds[0], m_batchFileIds.size(), &m_batchHashValues[0]);
+	}
 
+	/**
+	<@function. scoreInterestPackets
+	<@brief. Under the on-path caching there is no election, so every Interest packet is given the hash value 0 without hashing.
+	*/
+	void scoreInterestPackets(OnPathCaching)
+	{
+		m_batchHashValues.assign(m_interestList.size(), 0);
+	}
+
+	/**
+	<@function. electCachingRouter
+	<@brief. Take part in the election of the caching router of an Interest packet to be forwarded. The router is elected if it bids
+		a greater hash value than the routers elected before it. The weighted comparison of our paper "'Do My Best' Routing in
+		Named Data Networking" is not applied; the weights are recorded in the Interest packet only.
+	<@param. interestPacket, a reference variable, the Interest packet to be forwarded.
+	<@param. hashValue, the hash value the router bids with, i.e., the hash value of the router's salt and the requested file.
+	*/
+	void electCachingRouter(InterestPacket& interestPacket, float hashValue, SelectiveCaching)
+	{
+		if(hashValue > interestPacket.getHashValue())
+		{
+			//cout << "Update the weight, hash value and caching router value." << endl;
+			interestPacket.setCachingRouterDist(interestPacket.getCurrentRouterDist());
+			interestPacket.setWeight(m_weight);
+			interestPacket.setHashValue(hashValue);
+		}
+	}
+
+	void electCachingRouter(InterestPacket&, float, OnPathCaching)
+	{
+	}
+
+	/**
+	<@function. tagReturnDataPacket
+	<@brief. Tag a Data packet the router returns from its content store. Under the selective caching, the Data packet is a normal
+		Data packet, to be cached again by the caching router elected by the Interest packet, only if that router is far enough
+		from the router; otherwise it is a nocache Data packet.
+	<@param. returnDataPacket, a reference variable, the Data packet to be returned.
+	<@param. currentRouterDist, the distance of the router.
+	<@param. cachingRouterDist, the distance of the caching router elected by the Interest packet.
+	*/
+	void tagReturnDataPacket(DataPacket& returnDataPacket, int currentRouterDist, int cachingRouterDist, SelectiveCaching)
+	{
+		returnDataPacket.setCurrentRouterDist(currentRouterDist);
+		returnDataPacket.setCachingRouterDist(cachingRouterDist);
+		float floatCurrentRouterDist = float(currentRouterDist);
+		float floatCachingRouterDist = float(cachingRouterDist);
+		if(floatCurrentRouterDist - floatCachingRouterDist > cacheThreshold && floatCachingRouterDist/floatCurrentRouterDist < 0.618)	// I choose the gold ratio as the 
+		{																	// criterion; I don't know why, but I believe it will work well.
+			returnDataPacket.setType(DataPacket::normal);
+		}
+		else
+		{
+			returnDataPacket.setType(DataPacket::nocache);
+		}
+	}
+
+	void tagReturnDataPacket(DataPacket&, int, int, OnPathCaching)
+	{
+	}
 
 	/**
 	<@function. userOperation
@@ -957,53 +1111,40 @@ class Node
 	{
 		//cout << "in the userOperation" << endl;
 		//cout << "User " << m_id << " enters userOperation()" << endl;
+		m_unmetInterests.expireInterests(eventQueue.getNow(), interestTimeout);
 		if(100 == m_dataPacketSeqNum)
 		{
 			//srand((unsigned)time(0));
-			float randomNum = float(rand())/RAND_MAX;
-			int fileNameNum = fileNames.size();
-			int i = 0;
-			for(; i < fileNameNum; ++i)
-			{
-				if(randomNum <= fileRequestProbability[i])
-					break;
-			}
-			//randomNum = randomNum%fileNameNum;
-			m_fileToRequest = fileNames[i];
+			m_fileToRequest = popularitySampler.sample(m_random);
 			m_dataPacketSeqNum = 0;
 		}
 		/*if(m_userInterestCount < 10000)
 		{
 		*/	//cout << "User " << m_id << " initiates an Interest packet." << endl;
-		ostringstream convert;
-		convert << m_dataPacketSeqNum++;
-		string dataPacketSeqNumStr = convert.str();
-		string dataPacketName = m_fileToRequest + "/" + dataPacketSeqNumStr;
+		Name dataPacketName(m_fileToRequest, m_dataPacketSeqNum++);
 		//cout << dataPacketName << endl;
 		
-		int forwardingFace = *(m_links.begin());
+		int forwardingFace = topologyGraph.getNeighbours(m_id)[0];
 		
 		// Forward the Interest packet.
 		InterestPacket interestPacket(dataPacketName);
 		interestPacket.setArrivalFace(m_id);
-		interestPacket.insertUnavailableFace(forwardingFace);
+		excludeFace(interestPacket, forwardingFace, RoutingPolicy());
 		interestPacket.setId(++packetId);
 		nodes[forwardingFace].pendInterestPacket(interestPacket);
 		if(interestPacket.getId() >= lowerPacketNumLimit && interestPacket.getId() <= upperPacketNumLimit)
 		{
 			++measuredHopNum;
-			vector<string> substrs;
-			splitString(dataPacketName, substrs, '/');
-			string highestLevelPrefix = substrs[0];
+			int prefixId = nameTable.getFilePrefixId(dataPacketName.fileId);
 			// query the static FIB for the highest level prefix
 			bool doesExist;
 			int staticFace;
 			float staticMetric;
-			m_staticFib.query(highestLevelPrefix, doesExist, staticFace, staticMetric);
+			m_staticFib.query(prefixId, doesExist, staticFace, staticMetric);
 			requiredHopNum += 2*staticMetric;
 		}
 		++m_userInterestCount;
-		m_unmetInterestList.push_back(dataPacketName);
+		m_unmetInterests.insertInterest(dataPacketName, interestPacket.getId(), eventQueue.getNow(), interestTimeout);
 		//cout << "Interest " << dataPacketName << " user " << m_id << "--->" << forwardingFace << endl;
 		//}
 		
@@ -1018,12 +1159,13 @@ class Node
 			//cout << "hello" << endl;
 		/*	if(m_userDataCount < 10000)
 			{
-	*/		DataPacket dataPacket = m_dataList.front();
+	*/		DataPacket dataPacket(dataPacketPool.take(m_dataList.front()));
 			//m_userDataCount++;
 			m_dataList.pop_front();
 			dataPacket.increaseHopCount();
 			if(DataPacket::nack == dataPacket.getType())
 			{
+				m_unmetInterests.dropInterest(dataPacket.getName(), dataPacket.getId());
 				//cout << "User " << m_id << " failed to receive the Data packet: " << dataPacket.getName() << endl;
 				//cout << "User request failed: " << dataPacket.getName() << endl;
 			}
@@ -1031,23 +1173,22 @@ class Node
 			{// cout << "User " << m_id << " receives the Data packet from node " << dataPacket.getArrivalFace() << ": " << dataPacket.getName() << endl;
 				//cout << "Data " << dataPacket.getName() << " user " << m_id << "<---" << dataPacket.getArrivalFace()<< endl;
 				++m_userDataCount;
-				int cachingRouterId = dataPacket.getCachingRouterId();
-				//cout << "cachingRouterId = " << cachingRouterId << endl;
-				if(-1 != cachingRouterId)
-				{
-					nodes[cachingRouterId].cacheDataPacket(dataPacket);
-				}
-				list<string>::iterator iter = find(m_unmetInterestList.begin(), m_unmetInterestList.end(), dataPacket.getName());
-				m_unmetInterestList.erase(iter);
-				vector<string> nameComponents;
-				splitString(dataPacket.getName(), nameComponents, '/');
-				string prefix = nameComponents[0];
+				cacheAtCachingRouter(dataPacket, CachePolicy());
+				int latency = 0;
+				bool isMatched = m_unmetInterests.satisfyInterest(dataPacket.getName(), dataPacket.getId(), eventQueue.getNow(), latency);
+				int prefixId = nameTable.getFilePrefixId(dataPacket.getName().fileId);
 				bool flag;
 				int staticFace;
 				float staticMetric;
-				m_staticFib.query(prefix, flag, staticFace, staticMetric);
+				m_staticFib.query(prefixId, flag, staticFace, staticMetric);
 				//cout << dataPacket.getName() << ": staticCost = " << 2*staticMetric << ", dynamicCost = " << dataPacket.getHopCount() << ", " ;
 				cerr << dataPacket.getHopCount()/float(2*staticMetric) << endl;
+				if(isMatched)
+				{
+					retrievalLatency << latency << endl;
+					totalRetrievalLatency += latency;
+				}
+				else ++m_unmatchedDataNum;	// A duplicate, or the Data packet of an Interest packet timed out or given up.
 				//cout << dataPacket.getHopCount()/float(2*staticMetric) << endl;
 				++responsePacketNum;
 				//cout << "responsePacketNum = " << responsePacketNum << endl;
@@ -1059,6 +1200,41 @@ class Node
 			//}
 		}
 	}
+
+	/**
+	<@function. excludeFace
+	<@brief. Under the dynamic routing, an end user marks the face it sends an Interest packet through as unavailable, so that the
+		Interest packet is never forwarded back to it.
+	*/
+	void excludeFace(InterestPacket& interestPacket, int forwardingFace, DynamicRouting)
+	{
+		interestPacket.insertUnavailableFace(forwardingFace);
+	}
+
+	void excludeFace(InterestPacket&, int, StaticRouting)
+	{
+	}
+
+	/**
+	<@function. cacheAtCachingRouter
+	<@brief. Under the selective caching, a cached Data packet that reaches an end user is handed back to its caching router. The
+		caching router records the routers that set up routing information for it on the way, so that their dynamic FIB entries
+		are erased when the caching router drops it.
+	<@param. dataPacket, the Data packet received by the end user.
+	*/
+	void cacheAtCachingRouter(const DataPacket& dataPacket, SelectiveCaching)
+	{
+		int cachingRouterId = dataPacket.getCachingRouterId();
+		//cout << "cachingRouterId = " << cachingRouterId << endl;
+		if(DataPacket::nocache != dataPacket.getType() && -1 != cachingRouterId)
+		{
+			nodes[cachingRouterId].cacheDataPacket(dataPacket);
+		}
+	}
+
+	void cacheAtCachingRouter(const DataPacket&, OnPathCaching)
+	{
+	}
 	
 	/**
 	<@function. producerOperation
@@ -1073,20 +1249,17 @@ class Node
 		//if(!m_interestList.empty())
 		while(!m_interestList.empty())
 		{
-			InterestPacket interestPacket = m_interestList.front();
+			InterestPacket interestPacket(interestPacketPool.take(m_interestList.front()));
 			m_interestList.pop_front();
 			interestPacket.increaseHopCount();
 			interestPacket.increaseCurrentRouterDist();
 			
-			string localPrefix = idPrefix[m_id];
-			string interestPacketName = interestPacket.getName();
-			vector<string> nameComponents;
-			splitString(interestPacketName, nameComponents, '/');
+			Name interestPacketName = interestPacket.getName();
 			int arrivalFace = interestPacket.getArrivalFace();
 			
 			//cout << "Interest " << interestPacketName << " producer " << m_id << "<---" << arrivalFace << endl;
 
-			if(localPrefix != nameComponents[0])
+			if(m_id != nameTable.getProducerId(interestPacketName.fileId))
 			{
 				DataPacket dataPacket;
 				dataPacket.setName(interestPacketName);
@@ -1146,33 +1319,27 @@ class Node
 	<@param. resultantFace, a reference variable. If there are some availbe face to forward the Interest packet, the face will be 
 		recorded into it. Otherwise the variable will be set to -1;
 	*/
-	void getAvailableFace(string interestPacketName, set<int> unavailableFaces, int& resultantFace)
+	void getAvailableFace(const Name& interestPacketName, const set<int>& unavailableFaces, int& resultantFace)
 	{
-		vector<string> substrs;
-		splitString(interestPacketName, substrs, '/');
-		if(substrs.size() < 3)
+		if(-1 == interestPacketName.fileId)
 		{
 			resultantFace = -1;
 			return;
 		}
-		string highestLevelPrefix = substrs[0];
-		vector<string>::reverse_iterator strIter = substrs.rbegin();
-		++strIter;
-		int dataPacketsNum;	//The number of Data packets the source file is devided into.
-		istringstream(*strIter) >> dataPacketsNum;
-		string trimedName = trimLastComponentFromName(interestPacketName);
+		int prefixId = nameTable.getFilePrefixId(interestPacketName.fileId);
+		int dataPacketsNum = nameTable.getChunksNum(interestPacketName.fileId);	//The number of Data packets the source file is devided into.
 		// query the static FIB for the highest level prefix
 		bool doesExist;
 		int staticFace;
 		float staticMetric;
-		m_staticFib.query(highestLevelPrefix, doesExist, staticFace, staticMetric); //attention. In the model we don't consider
+		m_staticFib.query(prefixId, doesExist, staticFace, staticMetric); //attention. In the model we don't consider
 		// the case where no matching static FIB entry exists temporarily.
 		
 		// query the dynamic FIB for the trimed name.
-		set<FaceInfo> faceInfos;		
-		m_dynamicFib.getMatchingFacesMetrics(trimedName, faceInfos);
+		FaceInfoView faceInfos = m_dynamicFib.getMatchingFaceInfos(interestPacketName.fileId);
 		
-		vector<FaceCost> faceCosts;
+		vector<FaceCost>& faceCosts = m_faceCosts;
+		faceCosts.clear();
 		FaceCost tempFaceCost;
 		
 		// Compute the cost to forward the Interest packet through 
@@ -1183,7 +1350,7 @@ class Node
 		
 		// Compute the costs to forward the Interest packet through 
 		// the faces associated with the matching dynamic FIB entry.
-		for(set<FaceInfo>::iterator iter(faceInfos.begin()), end(faceInfos.end());
+		for(FaceInfoView::const_iterator iter(faceInfos.begin()), end(faceInfos.end());
 			iter != end; ++iter)
 		{
 			tempFaceCost.face = iter->getFace();
@@ -1197,7 +1364,7 @@ class Node
 		vector<FaceCost>::iterator faceCostIter(faceCosts.begin()), faceCostEnd(faceCosts.end());
 		for(; faceCostIter != faceCostEnd; ++faceCostIter)
 		{
-			set<int>::iterator faceIter = unavailableFaces.find(faceCostIter->face);
+			set<int>::const_iterator faceIter = unavailableFaces.find(faceCostIter->face);
 			if(unavailableFaces.end() == faceIter)
 				break;
 		}
@@ -1207,6 +1374,16 @@ class Node
 		else resultantFace = faceCostIter->face;
 	}
 	
+	/**
+	<@function. elapseTime
+	<@brief. Advance the clock of the node's dynamic FIB, dropping the faces whose lifetime has run out.
+	<@param. deviation, the amount of elapsed time.
+	*/
+	void elapseTime(int deviation)
+	{
+		m_dynamicFib.timeElapse(deviation);
+	}
+
 	void setBetweennessCentrality(float betweennessCentrality)
 	{
 		m_betweennessCentrality = betweennessCentrality;
@@ -1229,8 +1406,8 @@ class Node
 
 	void setWeight()
 	{
-		//float temp = log((double)m_links.size()) + 0.5;
-		float temp = (float)m_links.size();
+		//float temp = log((double)getLinksNum()) + 0.5;
+		float temp = (float)getLinksNum();
 		m_weight = m_contentStore.getCapacity()/temp;
 	}
 	
@@ -1254,6 +1431,15 @@ class Node
 		return m_contentStore.getCapacity();
 	}	
 
+	/**
+	<@function. getContentStore
+	<@brief. Get the node's content store, e.g., for its hit and eviction counts.
+	*/
+	const ContentStore& getContentStore() const
+	{
+		return m_contentStore;
+	}
+
 	/**
 	<@function. dropDataPacket
 	<@brief. Drop a Data packet from the node's content store and modify the dynamic FIBs of other node accordingly.
@@ -1266,19 +1452,18 @@ class Node
 			DataPacket dataPacket= m_contentStore.dropDataPacket();
 			//cout << "Drop a Data packet: " << dataPacket.getName() << endl;
 			//dataPacket.print();
-			list<FaceMetric> relevantRouters;
-			dataPacket.getRelevantRouters(relevantRouters);
+			const vector<FaceMetric>& relevantRouters = dataPacket.getRelevantRouters();
 			
-			string dataPacketName = dataPacket.getName();
-			string trimedName = trimLastComponentFromName(dataPacketName);
+			Name dataPacketName = dataPacket.getName();
+			int fileId = dataPacketName.fileId;
 
-			for(list<FaceMetric>::iterator iter(relevantRouters.begin()), end(relevantRouters.end());
+			for(vector<FaceMetric>::const_iterator iter(relevantRouters.begin()), end(relevantRouters.end());
 				iter != end; ++iter)
 			{
 				//cout << "Modify the dynamic FIB of router " << iter->router << endl;
 				//cout << "Before modifying:" << endl;
 				//nodes[iter->router].printDynamicFib();
-				nodes[iter->router].m_dynamicFib.eraseRoutingInfo(trimedName, iter->faces, iter->metric);
+				nodes[iter->router].m_dynamicFib.eraseRoutingInfo(fileId, iter->faces, iter->metric);
 				//cout << "After modifying: " << endl;
 				//nodes[iter->router].printDynamicFib();
 			}
@@ -1309,6 +1494,15 @@ class Node
 		return m_userDataCount;
 	}
 
+	/**
+	<@function. getTimedOutInterestNum
+	<@brief. Get the number of Interest packets the end user has initiated that have been unmet for interestTimeout ticks, and given up.
+	*/
+	int getTimedOutInterestNum() const
+	{
+		return m_unmetInterests.getTimedOutNum();
+	}
+
 	/**
 	<@funcion. printStaticFib
 	<@brief. Print the node's static FIB.
@@ -1334,9 +1528,7 @@ class Node
 	void printUnmetInterests()
 	{
 		cout << "In node " << m_id << ":" << endl;
-		for(list<string>::iterator iter(m_unmetInterestList.begin()), end(m_unmetInterestList.end());
-			iter != end; ++iter)
-			cout << *iter << endl;
+		m_unmetInterests.print();
 	}
 	
 	/**
@@ -1346,9 +1538,8 @@ class Node
 	void printDataList()
 	{
 		cout << "Data List:" << endl;
-		for(list<DataPacket>::iterator iter(m_dataList.begin()), end(m_dataList.end());
-			iter != end; ++iter)
-			cout << iter->getName() << endl;
+		for(int position = 0; position < m_dataList.size(); ++position)
+			cout << dataPacketPool.at(m_dataList.at(position)).getName() << endl;
 	}
 
 	/**
@@ -1358,21 +1549,21 @@ class Node
 	void printInterestList()
 	{
 		cout << "Interest List: " << endl;
-		for(list<InterestPacket>::iterator iter(m_interestList.begin()), end(m_interestList.end());
-			iter != end; ++iter)
-			cout << iter->getName() << endl;
+		for(int position = 0; position < m_interestList.size(); ++position)
+			cout << interestPacketPool.at(m_interestList.at(position)).getName() << endl;
 	}
 
 	/**
 	<@function. printWaitingInterestList
-	<@brief. Print the names of m_pWaitingInterestList.
+	<@brief. Print the names of the waiting Interest packets, grouped by name.
 	*/
 	void printWaitingInterestList()
 	{
 		cout << "Waiting Interest List:" << endl;
-		for(list<InterestPacket>::iterator iter(m_waitingInterestList.begin()), end(m_waitingInterestList.end());
+		for(unordered_map<Name, vector<InterestPacket>, NameHash>::iterator iter(m_waitingInterests.begin()), end(m_waitingInterests.end());
 			iter != end; ++iter)
-			cout << iter->getName() << endl;
+			for(int i = 0; i < (int)iter->second.size(); ++i)
+				cout << iter->first << endl;
 	}
 	
 	/**
@@ -1420,7 +1611,7 @@ class Node
 	*/
 	bool waitingInterestListEmpty()
 	{
-		return m_waitingInterestList.empty();
+		return 0 == m_waitingInterestsNum;
 	}
 	
 	/**
@@ -1433,12 +1624,9 @@ class Node
 	<@param. metric, a reference variable, if corresponding routing information exists, metric will be set to the metric associated
 		with the matching static FIB entry.
 	*/
-	void getStaticRoutingInfo(string interestName, bool& flag, int& face, float& metric)
+	void getStaticRoutingInfo(const Name& interestName, bool& flag, int& face, float& metric)
 	{
-		vector<string> components;
-		splitString(interestName, components, '/');
-		string prefix = components[0];
-		m_staticFib.query(prefix, flag, face, metric);
+		m_staticFib.query(nameTable.getFilePrefixId(interestName.fileId), flag, face, metric);
 	}
 
 	/**
@@ -1447,13 +1635,13 @@ class Node
 	*/
 	void printContentStoreStat()
 	{
-		list<ContentStoreStat> contentStoreStat;
+		vector<ContentStoreStat> contentStoreStat;
 		m_contentStore.getStat(contentStoreStat);
 		cout << "capacity = " << m_contentStore.getCapacity() << endl;
 		cout << "remainderCapacity = " << m_contentStore.getRemainderCapacity() << endl;
-		for(list<ContentStoreStat>::iterator iter(contentStoreStat.begin()), end(contentStoreStat.end());
+		for(vector<ContentStoreStat>::iterator iter(contentStoreStat.begin()), end(contentStoreStat.end());
 			iter != end; ++iter)
-			cout << iter->prefix << "\t" << iter->count << endl;
+			cout << nameTable.getFileName(iter->fileId) << "\t" << iter->count << endl;
 	}
 	
 	/**
@@ -1471,15 +1659,15 @@ class Node
 			case user: strType = "user"; break;
 			case router: strType = "router";
 		}
-		cout << "number of links is " << m_links.size() << endl;
+		cout << "number of links is " << getLinksNum() << endl;
 		cout << "the number of Data packets in content store is " << m_contentStore.getSize() << endl;
 		cout << "the number of PIT entry in PIT is " << m_pit.getSize() << endl;
 		cout << "the number of static FIB entries is " << m_staticFib.getSize() << endl;
 		cout << "the number of dynamic FIB entries is " << m_dynamicFib.getSize() << endl;
 		cout << "the number of Data packets in Data list is " << m_dataList.size() << endl;
 		cout << "the number of Interest packets in Interest list is " << m_interestList.size() << endl;
-		cout << "the number of Interest packets in waiting list is " << m_waitingInterestList.size() << endl;
-		cout << "the number of Interest packets in unmet Interest list is " << m_unmetInterestList.size() << endl;
+		cout << "the number of Interest packets in waiting list is " << m_waitingInterestsNum << endl;
+		cout << "the number of Interest packets in unmet Interest list is " << m_unmetInterests.getSize() << endl;
 	}
 	
 	/**
@@ -1491,9 +1679,8 @@ class Node
 		cout << "the property of node:" << endl;
 		cout << "id: " << m_id << endl;
 		cout << "links: ";
-		for(set<int>::iterator iter(m_links.begin()), end(m_links.end());
-			iter != end; ++iter)
-			cout << *iter << " ";
+		for(int k = 0; k < getLinksNum(); ++k)
+			cout << topologyGraph.getNeighbours(m_id)[k] << " ";
 		cout << endl;
 		m_contentStore.print();
 		m_pit.print();
@@ -1504,7 +1691,7 @@ class Node
 		printWaitingInterestList();
 		cout << "Betweenness Centrality: " << m_betweennessCentrality << endl;
 		cout << "Weight: " << m_weight << endl;
-		cout << "File to Request: " << m_fileToRequest << endl;
+		cout << "File to Request: " << (-1 == m_fileToRequest ? "" : nameTable.getFileName(m_fileToRequest)) << endl;
 		cout << "Data packet Sequence Number: " << m_dataPacketSeqNum << endl;
 		cout << "----------" << endl;
 	}
@@ -1538,29 +1725,79 @@ class Node
 		return m_cachedDataPacketsNum;
 	}
 
+	/**
+	<@function. getUnmatchedDataNum
+	<@brief. Get the number of Data packets the end user has received that matched none of its unmet Interest packets, such as the
+		Data packets that came back after their Interest packets timed out.
+	*/
+	int getUnmatchedDataNum() const
+	{
+		return m_unmatchedDataNum;
+	}
+
+	/**
+	<@function. getDroppedInterestsNum
+	<@brief. Get the number of Interest packets dropped as the Interest packet queue of the node was full.
+	*/
+	int getDroppedInterestsNum() const
+	{
+		return m_droppedInterestsNum;
+	}
+
+	/**
+	<@function. getDroppedDataNum
+	<@brief. Get the number of Data packets dropped as the Data packet queue of the node was full.
+	*/
+	int getDroppedDataNum() const
+	{
+		return m_droppedDataNum;
+	}
+
+	/**
+	<@function. getGivenUpInterestNum
+	<@brief. Get the number of Interest packets the end user has initiated and given up, as a nack Data packet came back for them
+		or their Data packets were dropped.
+	*/
+	int getGivenUpInterestNum() const
+	{
+		return m_unmetInterests.getDroppedNum();
+	}
+
 	private:
 	int m_id;	//<@brief The identifier of the node. Every node  in the network will has a unique identifier.
-	set<int> m_links;	//<@brief The identifiers of the nodes to which the node is connected. 
 	ContentStore m_contentStore;	//<@brief The node's content store.
 	Pit m_pit;	//<@brief. Pointer to the Pending Interest Table of the node.
 	StaticFib m_staticFib;	//<@brief. Pointer to the static FIB of the node.
 	DynamicFib m_dynamicFib;	//<@brief. Pointer to the dynamic FIB of the node.
+	vector<FaceCost> m_faceCosts;	//<@brief. The candidate faces of getAvailableFace, kept between calls so that forwarding an Interest packet does not allocate memory.
 	Type m_type;	//<@brief. The type of the node, a producer node, a router node, a end user node, or some other kind of node.
-	list<DataPacket> m_dataList;	//<@brief. The list for the Data packet need to be processed.
-	list<InterestPacket> m_interestList;	//<@brief. The list for the Interest packet need to be processed.
-	list<InterestPacket> m_waitingInterestList;	//<brief. For the Interet packets that has been forwarded but neither corresponding nack packet nor 
-		// response Data packet has been received.
+	RingQueue<int> m_dataList;	//<@brief. The queue of the Data packets need to be processed, by their handles in dataPacketPool.
+	RingQueue<int> m_interestList;	//<@brief. The queue of the Interest packets need to be processed, by their handles in interestPacketPool.
+	unordered_map<Name, vector<InterestPacket>, NameHash> m_waitingInterests;	//<brief. For the Interet packets that has been forwarded but neither corresponding nack packet nor 
+		// response Data packet has been received, by their names, in the order they were forwarded.
+	int m_waitingInterestsNum;	//<@brief. The number of Interest packets in m_waitingInterests.
+	unordered_map<Name, vector<int>, NameHash> m_nackInterests;	//<@brief. The handles of the nack Interest packets in the Interest packet queue, by their names.
+	int m_cancelledInterestsNum;	//<@brief. The number of the cancelled nack Interest packets still in the Interest packet queue.
 	float m_betweennessCentrality;	//<@brief. The ego network betweenness centrality of the node. For the reasonning for the ego network betweenness
 		// centrality of a node, please refer to Martin Everett and Stephen P. Borgatti's "Ego network betweenness".
 	float m_weight;	//<@brief. The weight of a node to cache a given Data packet. Its value depends on the node's ego network betweenness centrality
 	// and its content store capacity.
-	string m_fileToRequest;	//<@brief. Which file the user will request.
+	int m_fileToRequest;	//<@brief. The ID of the file the user will request.
 	int m_dataPacketSeqNum;	//<@brief. The sequence number of Data packets to be requested.
 	int m_userInterestCount;	//<@brief. The number of Interest packets an end user has initiated.
 	int m_userDataCount;	//<@brief. The number of Data packets an end user has received.
-	list<string> m_unmetInterestList;	//<@brief. The list records the Interest packets whose 
-		// response Data packets has not been received.
+	UnmetInterestTable m_unmetInterests;	//<@brief. The table records the Interest packets whose 
+		// response Data packets has not been received, with the ticks they were issued at.
+	Random m_random;	//<@brief. The random number stream of the node.
+	vector<int> m_batchFileIds;	//<@brief. The IDs of the files requested by the batch of Interest packets being processed.
+	vector<float> m_batchHashValues;	//<@brief. The hash values the node bids with for the files in m_batchFileIds.
 	int m_cachedDataPacketsNum;	//<brief. The number of data packets that has been cached in the router.
+	int m_droppedInterestsNum;	//<@brief. The number of Interest packets dropped at the full Interest packet queue.
+	int m_droppedDataNum;	//<@brief. The number of Data packets dropped at the full Data packet queue.
+	int m_unmatchedDataNum;	//<@brief. The number of Data packets the end user has received that matched no unmet Interest packet.
 };
+
+template<class CachePolicy, class RoutingPolicy>
+vector<Node<CachePolicy, RoutingPolicy> > Node<CachePolicy, RoutingPolicy>::nodes;
 //bool Node::flag = true;
 #endif
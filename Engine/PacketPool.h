@@ -0,0 +1,146 @@
+// PacketPool.h
+// The packet pool holds the packets in flight and in the queues of the nodes during an experiment. A packet is put into the
+// pool once it is sent, and is referred to by its handle, i.e., the index of its slot, until the receiving node takes it
+// out to process it. The slots are allocated in slabs of fixed size, which are never freed or moved during an experiment,
+// and the slots released are kept in a free list and reused first, so once the pool has grown to the largest number of
+// packets in flight, sending and receiving a packet allocates nothing.
+#ifndef PACKET_POOL_H
+#define PACKET_POOL_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include "InterestPacket.h"
+#include "DataPacket.h"
+using namespace std;
+
+template<class Packet>
+class PacketPool
+{
+	public:
+	PacketPool()
+	{
+		m_slabs = vector<unique_ptr<Packet[]> >();
+		m_freeSlots = vector<int>();
+		m_slotsNum = 0;
+		m_occupancy = 0;
+		m_peakOccupancy = 0;
+	}
+
+	/**
+	<@function. clear
+	<@brief. Drop all the packets and free the slabs, before an experiment starts.
+	*/
+	void clear()
+	{
+		vector<unique_ptr<Packet[]> >().swap(m_slabs);
+		vector<int>().swap(m_freeSlots);
+		m_slotsNum = 0;
+		m_occupancy = 0;
+		m_peakOccupancy = 0;
+	}
+
+	/**
+	<@function. allocate
+	<@brief. Put a packet into the pool.
+	<@param. packet, the packet to be put into the pool.
+	<@return. The handle of the packet.
+	*/
+	int allocate(Packet packet)
+	{
+		int handle;
+		if(!m_freeSlots.empty())
+		{
+			handle = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			if(m_slotsNum == (int)m_slabs.size()*slabSize)
+				m_slabs.push_back(unique_ptr<Packet[]>(new Packet[slabSize]));
+			handle = m_slotsNum++;
+		}
+		at(handle) = move(packet);
+		if(++m_occupancy > m_peakOccupancy)
+			m_peakOccupancy = m_occupancy;
+		return handle;
+	}
+
+	Packet& at(int handle)
+	{
+		return m_slabs[handle/slabSize][handle%slabSize];
+	}
+
+	const Packet& at(int handle) const
+	{
+		return m_slabs[handle/slabSize][handle%slabSize];
+	}
+
+	/**
+	<@function. take
+	<@brief. Take a packet out of the pool, releasing its slot.
+	<@param. handle, the handle of the packet.
+	*/
+	Packet take(int handle)
+	{
+		Packet packet(move(at(handle)));
+		release(handle);
+		return packet;
+	}
+
+	/**
+	<@function. release
+	<@brief. Drop a packet from the pool, and put its slot into the free list.
+	<@param. handle, the handle of the packet.
+	*/
+	void release(int handle)
+	{
+		at(handle) = Packet();
+		m_freeSlots.push_back(handle);
+		--m_occupancy;
+	}
+
+	/**
+	<@function. getOccupancy
+	<@brief. Get the number of packets in the pool.
+	*/
+	int getOccupancy() const
+	{
+		return m_occupancy;
+	}
+
+	/**
+	<@function. getPeakOccupancy
+	<@brief. Get the largest number of packets the pool has held at the same time since it was cleared.
+	*/
+	int getPeakOccupancy() const
+	{
+		return m_peakOccupancy;
+	}
+
+	/**
+	<@function. getSlotsNum
+	<@brief. Get the number of slots allocated, i.e., the largest number of packets the slabs can hold without growing.
+	*/
+	int getSlotsNum() const
+	{
+		return m_slabs.size()*slabSize;
+	}
+
+	private:
+	static const int slabSize = 1024;	//<@brief. The number of slots in a slab.
+
+	vector<unique_ptr<Packet[]> > m_slabs;	//<@brief. The slabs, the handle h is the slot h % slabSize of the slab h / slabSize.
+	vector<int> m_freeSlots;	//<@brief. The slots released, reused in the reverse order they were released.
+	int m_slotsNum;	//<@brief. The number of slots ever handed out, the slots from m_slotsNum on are still to be handed out.
+	int m_occupancy;	//<@brief. The number of packets in the pool.
+	int m_peakOccupancy;	//<@brief. The largest number of packets in the pool at the same time.
+};
+
+extern PacketPool<InterestPacket> interestPacketPool;
+extern PacketPool<DataPacket> dataPacketPool;
+
+#endif
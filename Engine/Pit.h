@@ -0,0 +1,252 @@
+// PIT.h
+// The PIT is an open addressing hash table keyed by the interned name of the Interest packets, with linear probing and
+// backward shift deletion. The entries are stored in the slots of the table and modified in place, so aggregating an
+// Interest packet into an existing entry neither copies nor reinserts the entry.
+#ifndef PIT_H
+#define PIT_H
+
+//#include <vld.h>
+
+#include <set>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include "PitEntry.h"
+using namespace std;
+
+class Pit
+{
+	public:
+	Pit()
+	{
+		m_slots = vector<PitEntry>();
+		m_size = 0;
+	}
+
+	/**
+	<@function. insertEntry
+	<@brief. Insert an Pit entry into the Pit due to an Interest packet arrival.
+	<@param. name, the name of the Interest packet.
+	<@param. arrivalFace, the arrival face of the Interest packet.
+	<@param. hopCount, the hopCount of the arrival Interest packet.
+	<@param. currentRouterDist, the currentRouterDist property of the Interest packet.
+	<@besides. The function applies whether there is a PIT entry for the Interest packet or not.
+	*/
+	void insertEntry(const Name& name, int arrivalFace, int hopCount, int currentRouterDist, int interestPacketId)
+	{
+		PitInfo pitInfo;
+		pitInfo.m_arrivalFace = arrivalFace;
+		pitInfo.m_hopCount = hopCount;
+		pitInfo.m_distance = currentRouterDist;
+		pitInfo.m_interestPacketId = interestPacketId;
+		m_slots[findOrInsertSlot(name)].addPitInfo(pitInfo);
+	}
+
+	/**
+	<@function. insertEntry
+	<@brief. Insert an PIT entry into the PIT due to an Interest packet arrival.
+	<@param. name, the name of the Interest packet.
+	<@param. arrivalFace, the arrival face of the Interest packet.
+	<@param. hopCount, the hopCount of the arrival Interest packet.
+	<@param. currentRouterDist, the currentRouterDist property of the Interest packet.
+	<@param. forwardingFace, the forwarding face associated with the pit entry.
+	<@besides. The function applies whether there is a PIT entry for the Interest packet or not.
+	*/
+	void insertEntry(const Name& name, int arrivalFace, int hopCount, int currentRouterDist, int interestPacketId, int forwardingFace)
+	{
+		PitInfo pitInfo;
+		pitInfo.m_arrivalFace = arrivalFace;
+		pitInfo.m_hopCount = hopCount;
+		pitInfo.m_distance = currentRouterDist;
+		pitInfo.m_interestPacketId = interestPacketId;
+		PitEntry& pitEntry = m_slots[findOrInsertSlot(name)];
+		pitEntry.addPitInfo(pitInfo);
+		pitEntry.setForwardingFace(forwardingFace);
+	}
+
+	/**
+	<@function. getForwardingFace
+	<@brief. get the forwarding face of the PIT entry with which the given name is associated.
+	<@param. interestName, the name of the Interest packet of which we want to get the forwarding face
+	<@return. The function returns the forwarding face associated with the given name if a PIT entry corresponding to
+		the given name exists. Otherwise the function will return -1.
+	*/
+	int getForwardingFace(const Name& interestName) const
+	{
+		int slot = findSlot(interestName);
+		if(-1 == slot)
+			return -1;
+		return m_slots[slot].getForwardingFace();
+	}
+
+	/**
+	<@function. setForwardingFace
+	<@brief. Set the forwarding face of some PIT entry.
+	<@param. name, the Interest packet name corresponding to pit entry for which the forwarding face will be set.
+	<@param. forwardingFace, the forwarding face that will be set to.
+	<@return. If a pit entry corresponding to the given name, the function will set the forwarding face and return true, otherwise the function will return false.
+	*/
+	bool setForwardingFace(const Name& name, int forwardingFace)
+	{
+		int slot = findSlot(name);
+		if(-1 == slot)
+			return false;
+		m_slots[slot].setForwardingFace(forwardingFace);
+		return true;
+	}
+
+	/**
+	<@function. matchingEntryExists
+	<@brief. Check if there is a PIT entry matching with the given name.
+	<@param. name, the name will be checked against.
+	<@return. Return true if matching entry exists, otherwise return false
+	<@attention. Even if the face list of the matching entry is empty, the function will return true. (although I don't know how this would happen.)
+	*/
+	bool matchingEntryExists(const Name& name) const
+	{
+		return -1 != findSlot(name);
+	}
+
+	/**
+	<@function. extractPitInfos
+	<@brief. Move the PitInfos corresponding to a given Data packet's name out of the PIT, and drop the PIT entry.
+	<@param. name, the name of a Data packet
+	<@param. pitInfos, a reference variable, if there is an entry for the Data packet name, the PitInfos of the entry
+			 will be stored in it, in the order the Interest packets arrived. Otherwise the container will be left empty.
+	*/
+	void extractPitInfos(const Name& name, PitInfoList& pitInfos)
+	{
+		pitInfos.clear();
+		int slot = findSlot(name);
+		if(-1 == slot)
+			return;
+		m_slots[slot].extractPitInfos(pitInfos);
+		eraseSlot(slot);
+	}
+
+	/**
+	<@function dropEntry
+	<@brief Drop the Pit entry to which the given name is associated.
+	<@param name, the name associated to the PIT entry to be dropped.
+	*/
+	void dropEntry(const Name& name)
+	{
+		int slot = findSlot(name);
+		if(-1 != slot)
+			eraseSlot(slot);
+	}
+
+	/**
+	<@function. getSize
+	<@brief. Get the number of PIT entries in the PIT.
+	*/
+	int getSize() const
+	{
+		return m_size;
+	}
+
+	/**
+	<@function. print
+	<@brief. Print out the status of the PIT, with the entries in the order of their names.
+	*/
+	void print() const
+	{
+		cout << "the property of PIT:" << endl;
+		vector<pair<Name, int> > entries;
+		for(int i = 0; i < (int)m_slots.size(); ++i)
+		{
+			if(!m_slots[i].isEmpty())
+				entries.push_back(make_pair(m_slots[i].getName(), i));
+		}
+		sort(entries.begin(), entries.end());
+		for(vector<pair<Name, int> >::iterator iter(entries.begin()), end(entries.end());
+			iter != end; ++iter)
+			m_slots[iter->second].print();
+		cout << "----------" << endl;
+	}
+
+	private:
+	int getHomeSlot(const Name& name) const
+	{
+		return NameHash()(name) & (m_slots.size() - 1);
+	}
+
+	/**
+	<@function. findSlot
+	<@return. The slot holding the entry of the given name, or -1 if there is no such entry.
+	*/
+	int findSlot(const Name& name) const
+	{
+		if(0 == m_size)
+			return -1;
+		int mask = m_slots.size() - 1;
+		for(int slot = getHomeSlot(name); !m_slots[slot].isEmpty(); slot = (slot + 1) & mask)
+		{
+			if(m_slots[slot].getName() == name)
+				return slot;
+		}
+		return -1;
+	}
+
+	/**
+	<@function. findOrInsertSlot
+	<@return. The slot holding the entry of the given name. If there is no such entry, an entry without any PitInfo is created.
+	*/
+	int findOrInsertSlot(const Name& name)
+	{
+		if(4*(m_size + 1) > 3*(int)m_slots.size())
+			rehash(m_slots.empty() ? 8 : 2*m_slots.size());
+		int mask = m_slots.size() - 1;
+		int slot = getHomeSlot(name);
+		for(; !m_slots[slot].isEmpty(); slot = (slot + 1) & mask)
+		{
+			if(m_slots[slot].getName() == name)
+				return slot;
+		}
+		m_slots[slot].reset(name);
+		++m_size;
+		return slot;
+	}
+
+	/**
+	<@function. eraseSlot
+	<@brief. Empty a slot, then move back the entries following it that would otherwise become unreachable.
+	*/
+	void eraseSlot(int slot)
+	{
+		int mask = m_slots.size() - 1;
+		m_slots[slot].reset(Name());
+		--m_size;
+		for(int next = (slot + 1) & mask; !m_slots[next].isEmpty(); next = (next + 1) & mask)
+		{
+			int home = getHomeSlot(m_slots[next].getName());
+			// The entry stays if its home slot lies cyclically in (slot, next].
+			if(slot <= next ? (slot < home && home <= next) : (slot < home || home <= next))
+				continue;
+			m_slots[slot].swap(m_slots[next]);
+			slot = next;
+		}
+	}
+
+	void rehash(int slotsNum)
+	{
+		vector<PitEntry> oldSlots(slotsNum);
+		m_slots.swap(oldSlots);
+		int mask = slotsNum - 1;
+		for(vector<PitEntry>::iterator iter(oldSlots.begin()), end(oldSlots.end());
+			iter != end; ++iter)
+		{
+			if(iter->isEmpty())
+				continue;
+			int slot = getHomeSlot(iter->getName());
+			while(!m_slots[slot].isEmpty())
+				slot = (slot + 1) & mask;
+			m_slots[slot].swap(*iter);
+		}
+	}
+
+	vector<PitEntry> m_slots;	//<@brief. The slots of the hash table. The number of slots is zero or a power of two.
+	int m_size;	//<@brief. The number of PIT entries.
+};
+
+#endif
@@ -0,0 +1,242 @@
+// PITEntry.h
+#ifndef PIT_ENTRY_H
+#define PIT_ENTRY_H
+
+//#include <vld.h>
+
+#include <string>
+#include <set>
+#include <utility>
+#include <vector>
+#include <list>
+#include <algorithm>
+
+#include "components.h"
+#include "NameTable.h"
+using namespace std;
+
+/**
+<@brief. The PitInfos of a PIT entry, in the order the Interest packets arrived. The first few PitInfos are stored inline,
+	so aggregating Interest packets into an entry does not allocate memory unless the entry grows unusually large.
+*/
+class PitInfoList
+{
+	public:
+	enum {inlineCapacity = 4};	//<@brief. The number of PitInfos stored without allocating memory.
+	typedef PitInfo* iterator;
+	typedef const PitInfo* const_iterator;
+
+	PitInfoList()
+	{
+		for(int i = 0; i < inlineCapacity; ++i)
+			m_inline[i] = PitInfo();
+		m_size = 0;
+		m_overflow = vector<PitInfo>();
+	}
+
+	void push_back(const PitInfo& pitInfo)
+	{
+		if(m_size < inlineCapacity && m_overflow.empty())
+		{
+			m_inline[m_size++] = pitInfo;
+			return;
+		}
+		if(m_overflow.empty())
+		{// Move the inline PitInfos out, so that the PitInfos stay contiguous.
+			m_overflow.reserve(2*inlineCapacity);
+			m_overflow.insert(m_overflow.end(), m_inline, m_inline + m_size);
+		}
+		m_overflow.push_back(pitInfo);
+		++m_size;
+	}
+
+	/**
+	<@function. remove
+	<@brief. Remove the PitInfos equal to the given one, keeping the order of the rest.
+	*/
+	void remove(const PitInfo& pitInfo)
+	{
+		iterator last = std::remove(begin(), end(), pitInfo);
+		m_size = last - begin();
+		if(!m_overflow.empty())
+			m_overflow.resize(m_size);
+	}
+
+	void clear()
+	{
+		m_size = 0;
+		m_overflow.clear();
+	}
+
+	/**
+	<@function. swap
+	<@brief. Exchange the PitInfos with another list. Only the inline PitInfos are copied; the overflow storage changes hands.
+	*/
+	void swap(PitInfoList& other)
+	{
+		for(int i = 0; i < inlineCapacity; ++i)
+			std::swap(m_inline[i], other.m_inline[i]);
+		std::swap(m_size, other.m_size);
+		m_overflow.swap(other.m_overflow);
+	}
+
+	bool empty() const
+	{
+		return 0 == m_size;
+	}
+
+	int size() const
+	{
+		return m_size;
+	}
+
+	iterator begin()
+	{
+		return m_overflow.empty() ? m_inline : &m_overflow[0];
+	}
+
+	iterator end()
+	{
+		return begin() + m_size;
+	}
+
+	const_iterator begin() const
+	{
+		return m_overflow.empty() ? m_inline : &m_overflow[0];
+	}
+
+	const_iterator end() const
+	{
+		return begin() + m_size;
+	}
+
+	private:
+	PitInfo m_inline[inlineCapacity];	//<@brief. The PitInfos, as long as there are no more than inlineCapacity of them.
+	int m_size;	//<@brief. The number of PitInfos in the list.
+	vector<PitInfo> m_overflow;	//<@brief. All the PitInfos, once there are more than inlineCapacity of them; empty otherwise.
+};
+
+/**
+<@brief. A slot of the PIT. A slot whose name is empty holds no entry.
+*/
+class PitEntry
+{
+	public:
+	PitEntry()
+	{
+		m_name = Name();
+		m_pitInfos = PitInfoList();
+		m_forwardingFace = -1;
+	}
+
+	PitEntry(const Name& name)
+	{
+		m_name = name;
+		m_pitInfos = PitInfoList();
+		m_forwardingFace = -1;
+	}
+
+	/**
+	<@function. swap
+	<@brief. Exchange the contents of two slots without copying the overflow PitInfos.
+	*/
+	void swap(PitEntry& other)
+	{
+		std::swap(m_name, other.m_name);
+		m_pitInfos.swap(other.m_pitInfos);
+		std::swap(m_forwardingFace, other.m_forwardingFace);
+	}
+
+	/**
+	<@function. reset
+	<@brief. Turn the slot into an entry for the given name without any PitInfo.
+	*/
+	void reset(const Name& name)
+	{
+		m_name = name;
+		m_pitInfos.clear();
+		m_forwardingFace = -1;
+	}
+
+	bool isEmpty() const
+	{
+		return -1 == m_name.fileId;
+	}
+
+	void setName(const Name& name)
+	{
+		m_name = name;
+	}
+
+	const Name& getName() const
+	{
+		return m_name;
+	}
+
+	void addPitInfo(const PitInfo& pitInfo)
+	{
+		m_pitInfos.push_back(pitInfo);
+	}
+
+	void removePitInfo(const PitInfo& pitInfo)
+	{
+		m_pitInfos.remove(pitInfo);
+	}
+
+	/**
+	<@function. extractPitInfos
+	<@brief. Move the PitInfos associated with the PIT entry out of it.
+	<@param. pitInfos, reference variable, the PitInfos of the entry will be stored in it and the entry will be left without any PitInfo.
+	*/
+	void extractPitInfos(PitInfoList& pitInfos)
+	{
+		pitInfos.clear();
+		pitInfos.swap(m_pitInfos);
+	}
+
+	const PitInfoList& getPitInfos() const
+	{
+		return m_pitInfos;
+	}
+
+	//<@function arrivalFacesEmpty
+	//<@brief Test if the face list associated with the PIT entry empty.
+	//<@return Return true is there is no face in the face list, return false otherwise.
+	bool pitInfosEmpty() const
+	{
+		return m_pitInfos.empty();
+	}
+
+	void setForwardingFace(int forwardingFace)
+	{
+		m_forwardingFace = forwardingFace;
+	}
+
+	int getForwardingFace() const
+	{
+		return m_forwardingFace;
+	}
+
+	/**
+	<@function. print
+	<@brief. Print out the content of the PIT entry.
+	*/
+	void print() const
+	{
+		cout << "PIT entry:" << endl;
+		cout << "name: " << m_name << endl;
+		cout << "forwarding face: " << m_forwardingFace << endl;
+		cout << "arrival faces: ";
+		for(PitInfoList::const_iterator iter(m_pitInfos.begin()), end(m_pitInfos.end());
+			iter != end; ++iter)
+			iter->print();
+	}
+
+	private:
+	Name m_name;	//<@brief The Interest packet's name corresponding to the PIT entry.
+	PitInfoList m_pitInfos;	//<@brief Record the information about the faces through which the response Data packet will be forwarded.
+	int m_forwardingFace;	//<@brief. The face through which the Interest packet corresponding to the PIT entry has been forwarded.
+};
+
+
+#endif
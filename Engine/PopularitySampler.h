@@ -0,0 +1,234 @@
+// PopularitySampler.h
+// The popularity sampler draws the files the end users request. The file of rank i (counting from 1) is requested with a
+// probability proportional to 1/i^alpha, i.e., the requests follow a Zipf-like distribution. There are three methods:
+// binarySearch searches the cumulative distribution of the files, which takes O(log n) time and O(n) memory; aliasTable
+// draws from Walker's alias table, which takes O(1) time and O(n) memory; rejectionInversion draws by the rejection-inversion
+// method of Hormann and Derflinger, which takes O(1) expected time and O(1) memory, so it applies to catalogs of any size.
+#ifndef POPULARITY_SAMPLER_H
+#define POPULARITY_SAMPLER_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "Random.h"
+
+using namespace std;
+
+class PopularitySampler
+{
+	public:
+	enum Method{binarySearch, aliasTable, rejectionInversion};
+
+	PopularitySampler()
+	{
+		init(0, 0.75, binarySearch);
+	}
+
+	/**
+	<@function. init
+	<@brief. Prepare the sampler for a catalog of files.
+	<@param. filesNum, the number of files, ranked from the most popular file 0 to the least popular file filesNum - 1.
+	<@param. alpha, the exponent of the Zipf-like distribution.
+	<@param. method, the way the files are drawn.
+	*/
+	void init(int filesNum, float alpha, Method method)
+	{
+		m_filesNum = filesNum;
+		m_alpha = alpha;
+		m_method = method;
+		m_cdf = vector<float>();
+		m_probabilities = vector<double>();
+		m_aliases = vector<int>();
+		if(0 == filesNum)
+			return;
+		if(binarySearch == method)
+			initCdf();
+		else if(aliasTable == method)
+			initAliasTable();
+		else if(rejectionInversion == method)
+			initRejectionInversion();
+	}
+
+	/**
+	<@function. sample
+	<@brief. Draw a file.
+	<@param. random, the random number stream to draw from.
+	<@return. The rank of the file, from 0 for the most popular file.
+	*/
+	int sample(Random& random) const
+	{
+		if(aliasTable == m_method)
+		{
+			double x = random.uniform()*m_filesNum;
+			int i = min(int(x), m_filesNum - 1);
+			return x - i < m_probabilities[i] ? i : m_aliases[i];
+		}
+		else if(rejectionInversion == m_method)
+		{
+			while(true)
+			{
+				double u = m_hIntegralFilesNum + random.uniform()*(m_hIntegralX1 - m_hIntegralFilesNum);
+				double x = hIntegralInverse(u);
+				int k = int(x + 0.5);
+				if(k < 1)
+					k = 1;
+				else if(k > m_filesNum)
+					k = m_filesNum;
+				if(k - x <= m_s || u >= hIntegral(k + 0.5) - h(k))
+					return k - 1;
+			}
+		}
+		float randomNum = random.uniform();
+		int i = lower_bound(m_cdf.begin(), m_cdf.end(), randomNum) - m_cdf.begin();
+		return min(i, m_filesNum - 1);
+	}
+
+	/**
+	<@function. getWeight
+	<@brief. Get the weight of a file, 1/rank^alpha, to which the probability the file is drawn is proportional.
+	<@param. file, the rank of the file, from 0 for the most popular file.
+	*/
+	double getWeight(int file) const
+	{
+		return 1/pow(double(file + 1), double(m_alpha));
+	}
+
+	private:
+	/**
+	<@function. initCdf
+	<@brief. Compute the cumulative distribution of the files, in single precision as it has always been computed.
+	*/
+	void initCdf()
+	{
+		float sum = 0;
+		for(int i = 0; i < m_filesNum; ++i)
+		{
+			float floatI = i + 1;
+			float temp = 1/pow(floatI, m_alpha);
+			sum += temp;
+			m_cdf.push_back(sum);
+		}
+		for(int i = 0; i < m_filesNum; ++i)
+			m_cdf[i] = m_cdf[i]/sum;
+	}
+
+	/**
+	<@function. initAliasTable
+	<@brief. Build the alias table by Vose's method. The file i is drawn with the probability m_probabilities[i] when
+		the column i is hit, and the file m_aliases[i] is drawn otherwise.
+	*/
+	void initAliasTable()
+	{
+		m_probabilities = vector<double>(m_filesNum);
+		m_aliases = vector<int>(m_filesNum);
+		double sum = 0;
+		for(int i = 0; i < m_filesNum; ++i)
+		{
+			m_probabilities[i] = h(i + 1);
+			sum += m_probabilities[i];
+		}
+		vector<int> smalls, larges;
+		for(int i = 0; i < m_filesNum; ++i)
+		{
+			m_probabilities[i] = m_probabilities[i]*m_filesNum/sum;
+			m_aliases[i] = i;
+			if(m_probabilities[i] < 1)
+				smalls.push_back(i);
+			else larges.push_back(i);
+		}
+		while(!smalls.empty() && !larges.empty())
+		{
+			int small = smalls.back();
+			smalls.pop_back();
+			int large = larges.back();
+			m_aliases[small] = large;
+			m_probabilities[large] -= 1 - m_probabilities[small];
+			if(m_probabilities[large] < 1)
+			{
+				larges.pop_back();
+				smalls.push_back(large);
+			}
+		}
+		// The columns left are full, up to rounding errors.
+		for(vector<int>::iterator iter(smalls.begin()), end(smalls.end());
+			iter != end; ++iter)
+			m_probabilities[*iter] = 1;
+		for(vector<int>::iterator iter(larges.begin()), end(larges.end());
+			iter != end; ++iter)
+			m_probabilities[*iter] = 1;
+	}
+
+	void initRejectionInversion()
+	{
+		m_hIntegralX1 = hIntegral(1.5) - 1;
+		m_hIntegralFilesNum = hIntegral(m_filesNum + 0.5);
+		m_s = 2 - hIntegralInverse(hIntegral(2.5) - h(2));
+	}
+
+	/**
+	<@function. h
+	<@brief. The unnormalized probability of the rank x, i.e., 1/x^alpha.
+	*/
+	double h(double x) const
+	{
+		return exp(-m_alpha*log(x));
+	}
+
+	/**
+	<@function. hIntegral
+	<@brief. An antiderivative of h, i.e., (x^(1 - alpha) - 1)/(1 - alpha), or log(x) if alpha is 1.
+	*/
+	double hIntegral(double x) const
+	{
+		double logX = log(x);
+		return helper2((1 - m_alpha)*logX)*logX;
+	}
+
+	double hIntegralInverse(double x) const
+	{
+		double t = x*(1 - m_alpha);
+		if(t < -1)
+			t = -1;	// Rounding errors may take t out of the domain of the inverse.
+		return exp(helper1(t)*x);
+	}
+
+	/**
+	<@function. helper1
+	<@brief. log(1 + x)/x, which is accurate as x gets close to 0.
+	*/
+	static double helper1(double x)
+	{
+		if(fabs(x) > 1e-8)
+			return log1p(x)/x;
+		return 1 - x*(0.5 - x*(1.0/3 - 0.25*x));
+	}
+
+	/**
+	<@function. helper2
+	<@brief. (exp(x) - 1)/x, which is accurate as x gets close to 0.
+	*/
+	static double helper2(double x)
+	{
+		if(fabs(x) > 1e-8)
+			return expm1(x)/x;
+		return 1 + x*0.5*(1 + x*(1.0/3)*(1 + 0.25*x));
+	}
+
+	int m_filesNum;	//<@brief. The number of files.
+	float m_alpha;	//<@brief. The exponent of the Zipf-like distribution.
+	Method m_method;	//<@brief. The way the files are drawn.
+	vector<float> m_cdf;	//<@brief. The cumulative distribution of the files, for binarySearch.
+	vector<double> m_probabilities;	//<@brief. The probability to keep the file of every column of the alias table, for aliasTable.
+	vector<int> m_aliases;	//<@brief. The alias of every column of the alias table, for aliasTable.
+	double m_hIntegralX1;	//<@brief. hIntegral(1.5) - h(1), for rejectionInversion.
+	double m_hIntegralFilesNum;	//<@brief. hIntegral(m_filesNum + 0.5), for rejectionInversion.
+	double m_s;	//<@brief. The width of the region around every rank where the draws are accepted without a test, for rejectionInversion.
+};
+
+extern PopularitySampler popularitySampler;
+
+#endif
@@ -0,0 +1,130 @@
+// Random.h
+// A stream of random numbers, generated by xoshiro256** of Blackman and Vigna and seeded through splitmix64. Every consumer
+// of random numbers in an experiment, i.e., the set-up of the topology and the files, the scheduler, and every node, draws
+// from a stream of its own, so the numbers a consumer gets do not depend on how the draws of the consumers interleave.
+// All the streams of an experiment are split off a single seed: split() hands out the current stream and jumps ahead by
+// 2^128 draws, so the streams never overlap, and an experiment is reproduced from its seed whatever the order of the draws.
+#ifndef RANDOM_H
+#define RANDOM_H
+
+//#include <vld.h>
+
+using namespace std;
+
+class Random
+{
+	public:
+	Random()
+	{
+		seed(0);
+	}
+
+	Random(unsigned long long seedValue)
+	{
+		seed(seedValue);
+	}
+
+	/**
+	<@function. seed
+	<@brief. Restart the stream from the state splitmix64 derives from the given seed.
+	*/
+	void seed(unsigned long long seedValue)
+	{
+		for(int i = 0; i < 4; ++i)
+		{
+			seedValue += 0x9e3779b97f4a7c15ULL;
+			unsigned long long z = seedValue;
+			z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+			m_state[i] = z ^ (z >> 31);
+		}
+	}
+
+	/**
+	<@function. next
+	<@brief. Draw 64 random bits.
+	*/
+	unsigned long long next()
+	{
+		unsigned long long result = rotateLeft(m_state[1]*5, 7)*9;
+		unsigned long long t = m_state[1] << 17;
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = rotateLeft(m_state[3], 45);
+		return result;
+	}
+
+	/**
+	<@function. nextInt
+	<@brief. Draw an integer uniformly distributed in [0, n).
+	*/
+	int nextInt(int n)
+	{
+		return int(((next() >> 32)*(unsigned long long)n) >> 32);
+	}
+
+	/**
+	<@function. uniform
+	<@brief. Draw a real number uniformly distributed in [0, 1), with 53 random bits.
+	*/
+	double uniform()
+	{
+		return (next() >> 11)*(1.0/9007199254740992.0);
+	}
+
+	/**
+	<@brief. Draw an integer in [0, n), so that the stream can be given to random_shuffle.
+	*/
+	int operator()(int n)
+	{
+		return nextInt(n);
+	}
+
+	/**
+	<@function. jump
+	<@brief. Advance the stream by 2^128 draws.
+	*/
+	void jump()
+	{
+		static const unsigned long long jumpPolynomial[4] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+		unsigned long long state[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+		{
+			for(int b = 0; b < 64; ++b)
+			{
+				if(jumpPolynomial[i] & (1ULL << b))
+				{
+					for(int j = 0; j < 4; ++j)
+						state[j] ^= m_state[j];
+				}
+				next();
+			}
+		}
+		for(int j = 0; j < 4; ++j)
+			m_state[j] = state[j];
+	}
+
+	/**
+	<@function. split
+	<@brief. Hand out the stream as it is, then jump ahead, so that the streams split off one after another never overlap.
+	*/
+	Random split()
+	{
+		Random stream = *this;
+		jump();
+		return stream;
+	}
+
+	private:
+	static unsigned long long rotateLeft(unsigned long long x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	unsigned long long m_state[4];	//<@brief. The state of xoshiro256**.
+};
+
+#endif
@@ -0,0 +1,86 @@
+// ReplacementPolicies.h
+// The replacement policies a content store may be run with, and their names, by which a run selects one, see README.md.
+// lru is the policy the content stores have always used, and the outputs of a run with it are named as they always have been;
+// the outputs of a run with another policy have its name appended, e.g., experiment88_sado_hopRatio_arc.dt.
+#ifndef REPLACEMENT_POLICIES_H
+#define REPLACEMENT_POLICIES_H
+
+//#include <vld.h>
+
+#include <string>
+
+#include "ReplacementPolicy.h"
+#include "LruPolicy.h"
+#include "LfuPolicy.h"
+#include "ArcPolicy.h"
+#include "S3FifoPolicy.h"
+#include "WTinyLfuPolicy.h"
+#include "WeightedPolicy.h"
+using namespace std;
+
+/**
+<@function. createReplacementPolicy
+<@brief. Create a replacement policy of a given type, with no slot in it.
+*/
+inline ReplacementPolicy* createReplacementPolicy(ReplacementPolicy::Type type)
+{
+	switch(type)
+	{
+		case ReplacementPolicy::lfu: return new LfuPolicy();
+		case ReplacementPolicy::arc: return new ArcPolicy();
+		case ReplacementPolicy::s3fifo: return new S3FifoPolicy();
+		case ReplacementPolicy::wtinylfu: return new WTinyLfuPolicy();
+		case ReplacementPolicy::weighted: return new WeightedPolicy();
+		default: return new LruPolicy();
+	}
+}
+
+/**
+<@function. getReplacementPolicyName
+<@brief. Get the name of a type of replacement policy, i.e., lru, lfu, arc, s3fifo, wtinylfu or weighted.
+*/
+inline string getReplacementPolicyName(ReplacementPolicy::Type type)
+{
+	switch(type)
+	{
+		case ReplacementPolicy::lfu: return "lfu";
+		case ReplacementPolicy::arc: return "arc";
+		case ReplacementPolicy::s3fifo: return "s3fifo";
+		case ReplacementPolicy::wtinylfu: return "wtinylfu";
+		case ReplacementPolicy::weighted: return "weighted";
+		default: return "lru";
+	}
+}
+
+/**
+<@function. parseReplacementPolicy
+<@brief. Get the type of replacement policy of a given name.
+<@param. name, the name of the policy.
+<@param. type, a reference variable, the type will be saved in it.
+<@return. If there is no policy of the name, the function returns false.
+*/
+inline bool parseReplacementPolicy(const string& name, ReplacementPolicy::Type& type)
+{
+	ReplacementPolicy::Type types[] = {ReplacementPolicy::lru, ReplacementPolicy::lfu, ReplacementPolicy::arc,
+		ReplacementPolicy::s3fifo, ReplacementPolicy::wtinylfu, ReplacementPolicy::weighted};
+	for(int i = 0; i < (int)(sizeof(types)/sizeof(types[0])); ++i)
+	{
+		if(getReplacementPolicyName(types[i]) == name)
+		{
+			type = types[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+<@function. getReplacementPolicySuffix
+<@brief. Get the suffix of the names of the output files of a run with a type of replacement policy, empty for lru.
+*/
+inline string getReplacementPolicySuffix(ReplacementPolicy::Type type)
+{
+	return ReplacementPolicy::lru == type ? "" : "_" + getReplacementPolicyName(type);
+}
+
+#endif
@@ -0,0 +1,322 @@
+// ReplacementPolicy.h
+// The replacement policy of a content store decides which cached Data packet is evicted to make room for a new one. The
+// content store keeps the Data packets in slots and tells the policy about every slot it fills, every hit and every miss,
+// and asks it for the slot to be evicted; the policy keeps its own order of the slots and never touches the Data packets.
+// The policies are selected per run, see ReplacementPolicies.h, and every operation of every policy takes constant
+// (amortised) time. SlotLists and GhostList are the building blocks the policies keep their orders in.
+#ifndef REPLACEMENT_POLICY_H
+#define REPLACEMENT_POLICY_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <unordered_map>
+
+#include "NameTable.h"
+using namespace std;
+
+class ReplacementPolicy
+{
+	public:
+	enum Type{lru, lfu, arc, s3fifo, wtinylfu, weighted};
+
+	virtual ~ReplacementPolicy()
+	{
+	}
+
+	/**
+	<@function. clone
+	<@brief. Copy the policy together with its state, for the copy of a content store.
+	*/
+	virtual ReplacementPolicy* clone() const = 0;
+
+	/**
+	<@function. setCapacity
+	<@brief. The content store has been given its capacity, or a new one. The policies that size their lists by the cache size
+		take it from here.
+	<@param. dataPacketsNum, the number of Data packets the content store holds when it is full, at least 1.
+	*/
+	virtual void setCapacity(int)
+	{
+	}
+
+	/**
+	<@function. insert
+	<@brief. A Data packet has been cached in a slot.
+	<@param. slot, the slot.
+	<@param. name, the name of the Data packet.
+	<@param. atFront, whether the Data packet is given the most favourable position, or the least favourable one, in which case it
+		is the first to be evicted under LRU. ProSta puts the Data packets it caches at the least favourable position.
+	*/
+	virtual void insert(int slot, const Name& name, bool atFront) = 0;
+
+	/**
+	<@function. access
+	<@brief. The Data packet in a slot has been hit, or cached again.
+	*/
+	virtual void access(int slot, const Name& name) = 0;
+
+	/**
+	<@function. miss
+	<@brief. A Data packet has been looked up but is not in the content store.
+	*/
+	virtual void miss(const Name&)
+	{
+	}
+
+	/**
+	<@function. victim
+	<@brief. Choose the slot to be evicted next. The content store must not be empty. The content store evicts the slot and calls
+		erase right after, before any other call.
+	*/
+	virtual int victim() = 0;
+
+	/**
+	<@function. erase
+	<@brief. The Data packet in a slot has been evicted, and the slot may be reused.
+	*/
+	virtual void erase(int slot, const Name& name) = 0;
+
+	/**
+	<@function. first
+	<@brief. Get the first slot in the order of the policy, from the Data packet that would be kept longest to the next one to be
+		evicted, or -1 if the content store is empty. Together with next, it walks the cached Data packets.
+	*/
+	virtual int first() const = 0;
+
+	/**
+	<@function. next
+	<@brief. Get the slot following the given one in the order of the policy, or -1 if the given slot is the last one.
+	*/
+	virtual int next(int slot) const = 0;
+};
+
+/**
+<@brief. A fixed number of doubly linked lists of slots, chained through the links recorded per slot, so that moving a slot
+	between the lists or within a list takes constant time and allocates nothing once the slots are known. A slot is in one
+	list at most. The lists are walked by first and next in the order of their numbers, from the front to the back of each.
+*/
+class SlotLists
+{
+	public:
+	SlotLists(int listsNum = 1)
+	{
+		m_heads = vector<int>(listsNum, -1);
+		m_tails = vector<int>(listsNum, -1);
+		m_sizes = vector<int>(listsNum, 0);
+		m_prev = vector<int>();
+		m_next = vector<int>();
+		m_lists = vector<int>();
+	}
+
+	void pushFront(int list, int slot)
+	{
+		reserve(slot);
+		m_prev[slot] = -1;
+		m_next[slot] = m_heads[list];
+		if(-1 == m_heads[list])
+			m_tails[list] = slot;
+		else m_prev[m_heads[list]] = slot;
+		m_heads[list] = slot;
+		m_lists[slot] = list;
+		++m_sizes[list];
+	}
+
+	void pushBack(int list, int slot)
+	{
+		reserve(slot);
+		m_next[slot] = -1;
+		m_prev[slot] = m_tails[list];
+		if(-1 == m_tails[list])
+			m_heads[list] = slot;
+		else m_next[m_tails[list]] = slot;
+		m_tails[list] = slot;
+		m_lists[slot] = list;
+		++m_sizes[list];
+	}
+
+	/**
+	<@function. remove
+	<@brief. Take a slot out of its list. The slot must be in a list.
+	*/
+	void remove(int slot)
+	{
+		int list = m_lists[slot];
+		int prev = m_prev[slot];
+		int next = m_next[slot];
+		if(-1 == prev)
+			m_heads[list] = next;
+		else m_next[prev] = next;
+		if(-1 == next)
+			m_tails[list] = prev;
+		else m_prev[next] = prev;
+		m_lists[slot] = -1;
+		--m_sizes[list];
+	}
+
+	/**
+	<@function. moveToFront
+	<@brief. Move a slot in a list to the front of a list, the same list or another one.
+	*/
+	void moveToFront(int list, int slot)
+	{
+		if(m_heads[list] == slot)
+			return;
+		remove(slot);
+		pushFront(list, slot);
+	}
+
+	int front(int list) const
+	{
+		return m_heads[list];
+	}
+
+	int back(int list) const
+	{
+		return m_tails[list];
+	}
+
+	int size(int list) const
+	{
+		return m_sizes[list];
+	}
+
+	/**
+	<@function. getList
+	<@brief. Get the list a slot is in, or -1 if it is in none.
+	*/
+	int getList(int slot) const
+	{
+		return slot < (int)m_lists.size() ? m_lists[slot] : -1;
+	}
+
+	int first() const
+	{
+		for(int list = 0; list < (int)m_heads.size(); ++list)
+			if(-1 != m_heads[list])
+				return m_heads[list];
+		return -1;
+	}
+
+	int next(int slot) const
+	{
+		if(-1 != m_next[slot])
+			return m_next[slot];
+		for(int list = m_lists[slot] + 1; list < (int)m_heads.size(); ++list)
+			if(-1 != m_heads[list])
+				return m_heads[list];
+		return -1;
+	}
+
+	private:
+	void reserve(int slot)
+	{
+		if(slot < (int)m_lists.size())
+			return;
+		m_prev.resize(slot + 1, -1);
+		m_next.resize(slot + 1, -1);
+		m_lists.resize(slot + 1, -1);
+	}
+
+	vector<int> m_heads;	//<@brief. The front slot of every list, or -1 if the list is empty.
+	vector<int> m_tails;	//<@brief. The back slot of every list, or -1 if the list is empty.
+	vector<int> m_sizes;	//<@brief. The number of slots in every list.
+	vector<int> m_prev;	//<@brief. The slot before every slot in its list, or -1 for the front.
+	vector<int> m_next;	//<@brief. The slot after every slot in its list, or -1 for the back.
+	vector<int> m_lists;	//<@brief. The list every slot is in, or -1.
+};
+
+/**
+<@brief. The names of recently evicted Data packets, in the order they were evicted, with a hash index so that a name is found
+	and removed in constant time. The policies that adapt to the Data packets they evicted too early keep them.
+*/
+class GhostList
+{
+	public:
+	GhostList()
+	{
+		m_entries = vector<Entry>();
+		m_index = unordered_map<Name, int, NameHash>();
+		m_lists = SlotLists(1);
+		m_freeEntry = -1;
+	}
+
+	/**
+	<@function. pushFront
+	<@brief. Remember a name as the most recently evicted one. The name must not be in the list.
+	*/
+	void pushFront(const Name& name)
+	{
+		int entry;
+		if(-1 != m_freeEntry)
+		{
+			entry = m_freeEntry;
+			m_freeEntry = m_entries[entry].m_nextFree;
+		}
+		else
+		{
+			entry = m_entries.size();
+			m_entries.push_back(Entry());
+		}
+		m_entries[entry].m_name = name;
+		m_index[name] = entry;
+		m_lists.pushFront(0, entry);
+	}
+
+	/**
+	<@function. remove
+	<@brief. Forget a name.
+	<@return. If the name is not in the list, the function returns false.
+	*/
+	bool remove(const Name& name)
+	{
+		unordered_map<Name, int, NameHash>::iterator iter = m_index.find(name);
+		if(m_index.end() == iter)
+			return false;
+		release(iter->second);
+		m_index.erase(iter);
+		return true;
+	}
+
+	/**
+	<@function. popBack
+	<@brief. Forget the least recently evicted name. The list must not be empty.
+	*/
+	void popBack()
+	{
+		int entry = m_lists.back(0);
+		m_index.erase(m_entries[entry].m_name);
+		release(entry);
+	}
+
+	bool contains(const Name& name) const
+	{
+		return m_index.end() != m_index.find(name);
+	}
+
+	int size() const
+	{
+		return m_lists.size(0);
+	}
+
+	private:
+	struct Entry
+	{
+		Name m_name;
+		int m_nextFree;	//<@brief. The next entry of the free list, for a free entry.
+	};
+
+	void release(int entry)
+	{
+		m_lists.remove(entry);
+		m_entries[entry].m_nextFree = m_freeEntry;
+		m_freeEntry = entry;
+	}
+
+	vector<Entry> m_entries;	//<@brief. The names, each in an entry linked into the order of eviction by m_lists.
+	unordered_map<Name, int, NameHash> m_index;	//<@brief. Maps a name to its entry.
+	SlotLists m_lists;	//<@brief. The entries, from the most recently evicted name to the least recently evicted one.
+	int m_freeEntry;	//<@brief. The head of the list of free entries.
+};
+
+#endif
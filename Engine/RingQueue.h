@@ -0,0 +1,138 @@
+// RingQueue.h
+// The ring queue is the first-in-first-out queue of the packet handles waiting at a node. The handles are kept in a circular
+// buffer whose size is a power of two, so pushing and popping a handle take constant time and allocate nothing once the buffer
+// has grown to the longest the queue gets. A queue may be given a capacity, to bound the number of packets waiting at a node;
+// the queue only tells when it is full, and its node decides which packets to drop. The buffer grows as needed.
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+//#include <vld.h>
+
+#include <vector>
+
+using namespace std;
+
+template<class T>
+class RingQueue
+{
+	public:
+	RingQueue()
+	{
+		m_buffer = vector<T>(initialSize);
+		m_head = 0;
+		m_size = 0;
+		m_capacity = 0;
+	}
+
+	/**
+	<@function. setCapacity
+	<@brief. Bound the number of elements in the queue.
+	<@param. capacity, the largest number of elements in the queue, or 0 for no bound.
+	*/
+	void setCapacity(int capacity)
+	{
+		m_capacity = capacity;
+	}
+
+	int getCapacity() const
+	{
+		return m_capacity;
+	}
+
+	bool empty() const
+	{
+		return 0 == m_size;
+	}
+
+	int size() const
+	{
+		return m_size;
+	}
+
+	/**
+	<@function. isFull
+	<@brief. Check if the queue has reached its capacity.
+	*/
+	bool isFull() const
+	{
+		return 0 < m_capacity && m_size >= m_capacity;
+	}
+
+	/**
+	<@function. push_back
+	<@brief. Append an element to the queue, growing the buffer if it is full. The capacity is not checked, see isFull.
+	*/
+	void push_back(const T& element)
+	{
+		if(m_size == (int)m_buffer.size())
+			grow();
+		m_buffer[(m_head + m_size) & (m_buffer.size() - 1)] = element;
+		++m_size;
+	}
+
+	T& front()
+	{
+		return m_buffer[m_head];
+	}
+
+	void pop_front()
+	{
+		m_head = (m_head + 1) & (m_buffer.size() - 1);
+		--m_size;
+	}
+
+	/**
+	<@function. at
+	<@brief. Access the element at a given position, counted from the front of the queue.
+	*/
+	T& at(int position)
+	{
+		return m_buffer[(m_head + position) & (m_buffer.size() - 1)];
+	}
+
+	const T& at(int position) const
+	{
+		return m_buffer[(m_head + position) & (m_buffer.size() - 1)];
+	}
+
+	/**
+	<@function. erase
+	<@brief. Remove the element at a given position, counted from the front of the queue. The elements behind it move one
+		position forwards.
+	*/
+	void erase(int position)
+	{
+		for(int i = position; i < m_size - 1; ++i)
+			at(i) = at(i + 1);
+		--m_size;
+	}
+
+	void clear()
+	{
+		m_head = 0;
+		m_size = 0;
+	}
+
+	private:
+	/**
+	<@function. grow
+	<@brief. Double the buffer, moving the elements to the front of the new buffer in order.
+	*/
+	void grow()
+	{
+		vector<T> buffer(m_buffer.size()*2);
+		for(int i = 0; i < m_size; ++i)
+			buffer[i] = at(i);
+		m_buffer.swap(buffer);
+		m_head = 0;
+	}
+
+	static const int initialSize = 8;	//<@brief. The number of elements the buffer holds at first, a power of two.
+
+	vector<T> m_buffer;	//<@brief. The circular buffer; its size is a power of two.
+	int m_head;	//<@brief. The position of the front of the queue in the buffer.
+	int m_size;	//<@brief. The number of elements in the queue.
+	int m_capacity;	//<@brief. The largest number of elements in the queue, or 0 for no bound.
+};
+
+#endif
@@ -0,0 +1,148 @@
+// RouteSetup.h
+// The module configures the static FIBs of the network. Only the routes towards the producers are ever installed, so rather
+// than computing the shortest paths between all pairs of nodes, it runs one breadth-first search from every producer over the
+// graph of the topology. The searches of different producers are independent, so they may run in parallel.
+#ifndef ROUTE_SETUP_H
+#define ROUTE_SETUP_H
+
+//#include <vld.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <thread>
+
+#include "NameTable.h"
+#include "Graph.h"
+using namespace std;
+
+class RouteSetup
+{
+	public:
+	/**
+	<@function. RouteSetup
+	<@param. graph, the adjacency of the network, which must outlive the route setup.
+	*/
+	RouteSetup(const Graph& graph)
+	{
+		m_graph = &graph;
+		m_nodesNum = graph.getNodesNum();
+		m_producers = vector<int>();
+		m_distances = vector<vector<int> >();
+		m_faces = vector<vector<int> >();
+	}
+
+	/**
+	<@function. computeRoutes
+	<@brief. Compute the shortest path from every node to every producer.
+		Among the equal-cost next hops of a node, the one with the smallest ID is chosen, so the result does not depend on the number of threads.
+	<@param. producers, the IDs of the producers.
+	<@param. threadsNum, the number of threads among which the producers are distributed.
+	*/
+	void computeRoutes(const vector<int>& producers, int threadsNum = 1)
+	{
+		int producerNum = producers.size();
+		m_producers = producers;
+		m_distances = vector<vector<int> >(producerNum);
+		m_faces = vector<vector<int> >(producerNum);
+		if(threadsNum > producerNum)
+			threadsNum = producerNum;
+		if(threadsNum <= 1)
+		{
+			for(int i = 0; i < producerNum; ++i)
+				computeRoutesToProducer(i);
+			return;
+		}
+		vector<thread> workers;
+		for(int t = 0; t < threadsNum; ++t)
+			workers.push_back(thread(&RouteSetup::computeRoutesWorker, this, t, threadsNum));
+		for(vector<thread>::iterator iter(workers.begin()), end(workers.end());
+			iter != end; ++iter)
+			iter->join();
+	}
+
+	/**
+	<@function. installStaticFibEntries
+	<@brief. Insert a static FIB entry towards every producer into every node other than the producers.
+	<@param. nodes, the nodes in the network.
+	<@param. idPrefix, the highest level prefix of every producer.
+	*/
+	template<class NodeType>
+	void installStaticFibEntries(vector<NodeType>& nodes, map<int, string>& idPrefix) const
+	{
+		int producerNum = m_producers.size();
+		vector<int> prefixIds;
+		for(int j = 0; j < producerNum; ++j)
+			prefixIds.push_back(nameTable.getPrefixId(idPrefix[m_producers[j]]));
+		for(int i = 0; i < m_nodesNum; ++i)
+		{
+			if(NodeType::producer == nodes[i].getType())
+				continue;
+			for(int j = 0; j < producerNum; ++j)
+				nodes[i].insertStaticFibEntry(prefixIds[j], m_faces[j][i], m_distances[j][i]);
+		}
+	}
+
+	/**
+	<@function. getFace
+	<@brief. Get the next hop from a node towards a producer, or -1 if the producer is unreachable.
+	<@param. producerIndex, the position of the producer in the container given to computeRoutes.
+	<@param. node, the ID of the node.
+	*/
+	int getFace(int producerIndex, int node) const
+	{
+		return m_faces[producerIndex][node];
+	}
+
+	/**
+	<@function. getMetric
+	<@brief. Get the hop count from a node to a producer, or -1 if the producer is unreachable.
+	<@param. producerIndex, the position of the producer in the container given to computeRoutes.
+	<@param. node, the ID of the node.
+	*/
+	int getMetric(int producerIndex, int node) const
+	{
+		return m_distances[producerIndex][node];
+	}
+
+	private:
+	void computeRoutesWorker(int first, int step)
+	{
+		int producerNum = m_producers.size();
+		for(int i = first; i < producerNum; i += step)
+			computeRoutesToProducer(i);
+	}
+
+	void computeRoutesToProducer(int producerIndex)
+	{
+		int origin = m_producers[producerIndex];
+		vector<int>& distances = m_distances[producerIndex];
+		vector<int>& faces = m_faces[producerIndex];
+		faces = vector<int>(m_nodesNum, -1);
+		vector<int> order;
+		m_graph->breadthFirstSearch(origin, distances, order);
+		faces[origin] = origin;
+		for(int head = 1; head < (int)order.size(); ++head)
+		{
+			int temp = order[head];
+			const int* neighbours = m_graph->getNeighbours(temp);
+			for(int k = 0; k < m_graph->getDegree(temp); ++k)
+			{
+				if(distances[neighbours[k]] == distances[temp] - 1)
+				{
+					faces[temp] = neighbours[k];
+					break;
+				}
+			}
+		}
+	}
+
+	const Graph* m_graph;	//<@brief. The adjacency of the network.
+	int m_nodesNum;	//<@brief. The number of nodes in the network.
+	vector<int> m_producers;	//<@brief. The producers the routes lead to.
+	vector<vector<int> > m_distances;	//<@brief. The ith element records the hop count from every node to the ith producer.
+	vector<vector<int> > m_faces;	//<@brief. The ith element records the next hop from every node towards the ith producer.
+};
+
+#endif
@@ -0,0 +1,22 @@
+// RoutingPolicy.h
+// The routing policies of the routing schemes. StaticRouting forwards every Interest packet through the static FIB towards
+// the producer of the requested file, as SelSta, PerSta and ProSta do. DynamicRouting is the routing of SADO: the routers
+// record in their dynamic FIBs where the Data packets are cached, forward the Interest packets through the cheapest face
+// that has not been tried yet, and report the Interest packets no face is left for with nack packets. DynamicRouting
+// relies on the caching routers elected by SelectiveCaching.
+#ifndef ROUTING_POLICY_H
+#define ROUTING_POLICY_H
+
+//#include <vld.h>
+
+using namespace std;
+
+struct StaticRouting
+{
+};
+
+struct DynamicRouting
+{
+};
+
+#endif
@@ -0,0 +1,116 @@
+// S3FifoPolicy.h
+// The S3-FIFO replacement policy of Yang et al.'s "FIFO queues are all you need for cache eviction". A newly cached Data
+// packet enters the small FIFO queue S, which holds a tenth of the cache, unless its name is remembered in the ghost queue G,
+// in which case it enters the main FIFO queue M. A hit only increases the frequency of a Data packet, up to 3. A Data packet
+// leaving S is moved to M if it was hit more than once, or evicted and remembered in G otherwise; a Data packet leaving M is
+// put back at the front of M with its frequency decreased if it was hit, or evicted otherwise. So the Data packets requested
+// once are evicted from S quickly, which makes the policy resist scans. The size of the cache is the number of Data packets
+// the content store holds when it is full.
+#ifndef S3_FIFO_POLICY_H
+#define S3_FIFO_POLICY_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "ReplacementPolicy.h"
+using namespace std;
+
+class S3FifoPolicy : public ReplacementPolicy
+{
+	public:
+	S3FifoPolicy()
+	{
+		m_lists = SlotLists(2);
+		m_frequencies = vector<char>();
+		m_ghosts = GhostList();
+		m_capacity = 0;
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new S3FifoPolicy(*this);
+	}
+
+	void setCapacity(int dataPacketsNum)
+	{
+		m_capacity = dataPacketsNum;
+		while(m_ghosts.size() > m_capacity)
+			m_ghosts.popBack();
+	}
+
+	void insert(int slot, const Name& name, bool atFront)
+	{
+		if((int)m_frequencies.size() <= slot)
+			m_frequencies.resize(slot + 1);
+		m_frequencies[slot] = 0;
+		if(m_ghosts.remove(name))
+			m_lists.pushFront(mainQueue, slot);
+		else if(atFront)
+			m_lists.pushFront(smallQueue, slot);
+		else m_lists.pushBack(smallQueue, slot);
+	}
+
+	void access(int slot, const Name&)
+	{
+		if(m_frequencies[slot] < 3)
+			++m_frequencies[slot];
+	}
+
+	int victim()
+	{
+		while(true)
+		{
+			if(0 < m_lists.size(smallQueue) && (m_lists.size(smallQueue) >= max(1, m_capacity/10) || 0 == m_lists.size(mainQueue)))
+			{
+				int slot = m_lists.back(smallQueue);
+				if(m_frequencies[slot] <= 1)
+					return slot;
+				m_frequencies[slot] = 0;
+				m_lists.remove(slot);
+				m_lists.pushFront(mainQueue, slot);
+			}
+			else
+			{
+				int slot = m_lists.back(mainQueue);
+				if(0 == m_frequencies[slot])
+					return slot;
+				--m_frequencies[slot];
+				m_lists.moveToFront(mainQueue, slot);
+			}
+		}
+	}
+
+	void erase(int slot, const Name& name)
+	{
+		if(smallQueue == m_lists.getList(slot))
+		{
+			m_ghosts.pushFront(name);
+			while(m_ghosts.size() > m_capacity)
+				m_ghosts.popBack();
+		}
+		m_lists.remove(slot);
+	}
+
+	int first() const
+	{
+		return m_lists.first();
+	}
+
+	int next(int slot) const
+	{
+		return m_lists.next(slot);
+	}
+
+	private:
+	static const int mainQueue = 0;	//<@brief. The main queue M, walked first.
+	static const int smallQueue = 1;	//<@brief. The small queue S.
+
+	SlotLists m_lists;	//<@brief. The queues M and S, each from the most recently queued slot to the next one to leave.
+	vector<char> m_frequencies;	//<@brief. The number of hits of every slot since it was queued, up to 3.
+	GhostList m_ghosts;	//<@brief. The ghost queue G, the names of the Data packets evicted from S, at most as many as the cache holds.
+	int m_capacity;	//<@brief. The size of the cache, i.e., the number of Data packets the content store holds when it is full.
+};
+
+#endif
@@ -0,0 +1,164 @@
+// Scheduler.h
+// The scheduler decides which nodes are visited in a round of the simulation, and in which order. Visiting every node in
+// a uniformly random order is the same as giving every node an independent random time in [0, 1) and visiting the nodes in
+// the order of their times. A node with no pending packet does nothing when it is visited, so its time is only drawn when
+// it becomes active: if the time lies ahead of the current time, the node is visited later in the round, otherwise its
+// turn has passed and it is visited in the next round. This keeps the semantics of shuffling all the nodes every round,
+// while a round only costs the nodes that have pending packets and the end users, which are always active. The times of
+// every node are drawn from a random number stream of its own, so they do not depend on the order the nodes are activated in.
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+
+#include "Random.h"
+
+using namespace std;
+
+class Scheduler
+{
+	public:
+	Scheduler()
+	{
+		init(0, Random());
+	}
+
+	/**
+	<@function. init
+	<@brief. Reset the scheduler for a network of the given number of nodes, none of which is active.
+	<@param. random, the stream the random number streams of the nodes are split off.
+	*/
+	void init(int nodesNum, Random random)
+	{
+		m_round = 0;
+		m_now = 1;
+		m_times = vector<double>(nodesNum, 0);
+		m_rounds = vector<int>(nodesNum, -1);
+		m_alwaysActive = vector<bool>(nodesNum, false);
+		m_inWorklist = vector<bool>(nodesNum, false);
+		m_worklist = vector<int>();
+		m_alwaysActiveNodes = vector<int>();
+		m_agenda = vector<pair<double, int> >();
+		m_randoms = vector<Random>();
+		for(int i = 0; i < nodesNum; ++i)
+			m_randoms.push_back(random.split());
+	}
+
+	/**
+	<@function. setAlwaysActive
+	<@brief. Let a node be visited in every round whether it has pending packets or not, e.g., an end user generating Interest packets.
+	*/
+	void setAlwaysActive(int id)
+	{
+		if(m_alwaysActive[id])
+			return;
+		m_alwaysActive[id] = true;
+		m_alwaysActiveNodes.push_back(id);
+	}
+
+	/**
+	<@function. activate
+	<@brief. Make sure a node that has got pending packets will be visited, later in the current round if its turn has not passed, or in the next round.
+	*/
+	void activate(int id)
+	{
+		if(m_alwaysActive[id])
+			return;
+		if(m_round != m_rounds[id])
+		{// The node has been idle in the round so far, so its time has not been drawn yet.
+			m_rounds[id] = m_round;
+			m_times[id] = drawTime(id);
+			if(m_times[id] > m_now)
+			{
+				schedule(id);
+				return;
+			}
+		}
+		else if(m_times[id] > m_now)
+			return;	// The node is still to be visited in the round.
+		if(!m_inWorklist[id])
+		{
+			m_inWorklist[id] = true;
+			m_worklist.push_back(id);
+		}
+	}
+
+	/**
+	<@function. beginRound
+	<@brief. Start a new round, in which the always active nodes and the nodes activated too late in the previous round are visited.
+	*/
+	void beginRound()
+	{
+		++m_round;
+		m_now = 0;
+		m_agenda.clear();
+		for(vector<int>::iterator iter(m_alwaysActiveNodes.begin()), end(m_alwaysActiveNodes.end());
+			iter != end; ++iter)
+		{
+			m_rounds[*iter] = m_round;
+			m_times[*iter] = drawTime(*iter);
+			schedule(*iter);
+		}
+		for(vector<int>::iterator iter(m_worklist.begin()), end(m_worklist.end());
+			iter != end; ++iter)
+		{
+			m_inWorklist[*iter] = false;
+			m_rounds[*iter] = m_round;
+			m_times[*iter] = drawTime(*iter);
+			schedule(*iter);
+		}
+		m_worklist.clear();
+	}
+
+	/**
+	<@function. next
+	<@brief. Get the next node to visit in the current round.
+	<@return. The ID of the node, or -1 if the round is over.
+	*/
+	int next()
+	{
+		if(m_agenda.empty())
+		{
+			m_now = 1;
+			return -1;
+		}
+		pop_heap(m_agenda.begin(), m_agenda.end(), greater<pair<double, int> >());
+		m_now = m_agenda.back().first;
+		int id = m_agenda.back().second;
+		m_agenda.pop_back();
+		return id;
+	}
+
+	private:
+	double drawTime(int id)
+	{
+		return m_randoms[id].uniform();
+	}
+
+	void schedule(int id)
+	{
+		m_agenda.push_back(make_pair(m_times[id], id));
+		push_heap(m_agenda.begin(), m_agenda.end(), greater<pair<double, int> >());
+	}
+
+	int m_round;	//<@brief. The number of the current round.
+	double m_now;	//<@brief. The time of the node being visited. It is 1 between rounds.
+	vector<double> m_times;	//<@brief. The time every node is visited at in the round recorded in m_rounds.
+	vector<int> m_rounds;	//<@brief. The round in which the time of every node was last drawn.
+	vector<bool> m_alwaysActive;	//<@brief. Whether every node is visited in every round.
+	vector<bool> m_inWorklist;	//<@brief. Whether every node is in m_worklist.
+	vector<int> m_worklist;	//<@brief. The nodes to be visited in the next round, besides the always active ones.
+	vector<int> m_alwaysActiveNodes;	//<@brief. The nodes visited in every round.
+	vector<pair<double, int> > m_agenda;	//<@brief. The nodes still to be visited in the current round, as a min-heap of their times.
+	vector<Random> m_randoms;	//<@brief. The random number stream the times of every node are drawn from.
+};
+
+extern Scheduler scheduler;
+
+#endif
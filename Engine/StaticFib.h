@@ -5,6 +5,7 @@
 //#include <vld.h>
 
 #include "StaticFibEntry.h"
+#include "NameTable.h"
 #include <set>
 #include <utility>
 using namespace std;
@@ -24,14 +25,14 @@ class StaticFib
 	/**
 	<@function insertEntry
 	<@brief Insert a static FIB entry according to the given prefix, face, and metric
-	<@param prefix, the prefix corresponding to the new entry
+	<@param prefixId, the ID of the prefix corresponding to the new entry
 	<@param face, the face corresponding to the new entry
 	<@param metric, the metric corresponding to the new metric
 	<@attention If an entry with the given name has existed, the entry will be replaced by the new one.
 	*/
-	void insertEntry(string prefix, int face, float metric)
+	void insertEntry(int prefixId, int face, float metric)
 	{
-		StaticFibEntry entry(prefix, face, metric);
+		StaticFibEntry entry(prefixId, face, metric);
 		std::set<StaticFibEntry>::iterator iter = m_entries.find(entry);
 		if(m_entries.end() != iter)
 		{
@@ -43,12 +44,12 @@ class StaticFib
 	/**
 	<@function matchingEntryExists
 	<@brief Check if an static FIB entry with the given name has existed.
-	<@param prefix, the prefix will be checked against.
+	<@param prefixId, the ID of the prefix to be checked against.
 	<@return Return true if matching entry does exist, otherwise return false.
 	*/
-	bool matchingEntryExists(std::string prefix)
+	bool matchingEntryExists(int prefixId)
 	{
-		StaticFibEntry entry(prefix);
+		StaticFibEntry entry(prefixId);
 		std::set<StaticFibEntry>::iterator iter = m_entries.find(entry);
 		if(m_entries.end() == iter)
 			return false;
@@ -58,18 +59,20 @@ class StaticFib
 	/**
 	<@function. query
 	<@brief. Extract the face and metric corresponding to a given prefix.
-	<@param. prefix, the prefix corresponding to which the face and metric will be extracted.
+	<@param. prefixId, the ID of the prefix corresponding to which the face and metric will be extracted.
 	<@param. flag, a reference variable, if matching entry doesn't exist, flag will be set to false, otherwise it will be set to true.
-	<@param. face, a reference variable, in the case where a matching entry exists, face is set to the face associated with the matching entry.
-	<@param. metric, a reference variable, in the case where a matching entry exists, metric is set to the metric associated with the matching entry.
+	<@param. face, a reference variable, face is set to the face associated with the matching entry, or to -1 if there is none.
+	<@param. metric, a reference variable, metric is set to the metric associated with the matching entry, or to 0 if there is none.
 	*/
-	void query(std::string prefix, bool& flag, int& face, float& metric)
+	void query(int prefixId, bool& flag, int& face, float& metric)
 	{
-		StaticFibEntry entry(prefix);
+		StaticFibEntry entry(prefixId);
 		std::set<StaticFibEntry>::iterator iter = m_entries.find(entry);
 		if(m_entries.end() == iter)
 		{
 			flag = false;
+			face = -1;
+			metric = 0;
 			return;
 		}
 		flag = true;
@@ -80,25 +83,25 @@ class StaticFib
 	/**
 	<@function dropEntry
 	<@brief Drop the FIB entry corresponding to the given prefix.
-	<@param prefix, the prefix corresponding to which the FIB entry will be dropped.
+	<@param prefixId, the ID of the prefix corresponding to which the FIB entry will be dropped.
 	*/
-	void dropEntry(std::string prefix)
+	void dropEntry(int prefixId)
 	{
-		StaticFibEntry entry(prefix);
+		StaticFibEntry entry(prefixId);
 		m_entries.erase(entry);
 	}
 	
 	/**
 	<@function updateFace
 	<@brief Update the face associated to a prefix
-	<@param prefix, the prefix associated to which the face will be updated.
+	<@param prefixId, the ID of the prefix associated to which the face will be updated.
 	<@param face, the new face as which the face associated with the prefix.
 	<@attention The function is applied only when the FIB entry matched with the given prefix exists.
 				In the case where matching FIB entry doesn't exist, there will be no operation.
 	*/
-	void updateFace(std::string prefix, int face)
+	void updateFace(int prefixId, int face)
 	{
-		StaticFibEntry entry(prefix);
+		StaticFibEntry entry(prefixId);
 		entry.setFace(face);
 		std::set<StaticFibEntry>::iterator iter = m_entries.find(entry);
 		if(m_entries.end() != iter)
@@ -112,14 +115,14 @@ class StaticFib
 	/**
 	<@function updateMetric
 	<@brief UPdate the metric associated with a given prefix to a new value.
-	<@param prefix, the prefix associated to which the metric will be updated.
+	<@param prefixId, the ID of the prefix associated to which the metric will be updated.
 	<@param metric, the new metric will be associated to the given prefix
 	<@attenttion The function is applied only when a FIB entry matched with the given prefix exists.
 				In the case where there is no matching entry exists, the function is of no effect.
 	*/
-	void updateMetric(std::string prefix, float metric)
+	void updateMetric(int prefixId, float metric)
 	{
-		StaticFibEntry entry(prefix);
+		StaticFibEntry entry(prefixId);
 		entry.setMetric(metric);
 		std::set<StaticFibEntry>::iterator iter = m_entries.find(entry);
 		if(m_entries.end() != iter)
@@ -140,7 +143,7 @@ class StaticFib
 		for(set<StaticFibEntry>::iterator iter(m_entries.begin()), end(m_entries.end());
 			iter != end; ++iter)
 		{
-			cout << "prefix = " << iter->getPrefix() << ", face = " << iter->getFace() << ", metric = " << iter->getMetric() << endl;
+			cout << "prefix = " << nameTable.getPrefix(iter->getPrefixId()) << ", face = " << iter->getFace() << ", metric = " << iter->getMetric() << endl;
 		}
 		cout << "----------" << endl;
 	}
@@ -21,52 +21,52 @@ class StaticFibEntry
 	public:
 	StaticFibEntry()
 	{
-		m_prefix = "";
+		m_prefixId = -1;
 		m_face = 0;
 		m_metric = 0;
 	}
 	
-	StaticFibEntry(std::string prefix, int face, float metric)
+	StaticFibEntry(int prefixId, int face, float metric)
 	{
-		m_prefix = prefix;
+		m_prefixId = prefixId;
 		m_face = face;
 		m_metric = metric;
 	}
 	
-	StaticFibEntry(std::string prefix)
+	StaticFibEntry(int prefixId)
 	{
-		m_prefix = prefix;
+		m_prefixId = prefixId;
 		m_face = 0;
 		m_metric = 0;
 	}
 	
 	StaticFibEntry(const StaticFibEntry& other)
 	{
-		m_prefix = other.getPrefix();
+		m_prefixId = other.getPrefixId();
 		m_face = other.getFace();
 		m_metric = other.getMetric();
 	}
 	
 	void operator=(const StaticFibEntry& other)
 	{
-		m_prefix = other.getPrefix();
+		m_prefixId = other.getPrefixId();
 		m_face = other.getFace();
 		m_metric = other.getMetric();
 	}
 
 	bool operator<(const StaticFibEntry& other) const
 	{
-		return m_prefix < other.getPrefix();
+		return m_prefixId < other.getPrefixId();
 	}
 	
-	void setPrefix(std::string prefix)
+	void setPrefixId(int prefixId)
 	{
-		m_prefix = prefix;
+		m_prefixId = prefixId;
 	}
 	
-	string getPrefix() const
+	int getPrefixId() const
 	{
-		return m_prefix;
+		return m_prefixId;
 	}
 	
 	void setFace(int face)
@@ -99,7 +99,7 @@ class StaticFibEntry
 		m_metric -= deviation;
 	}
 	private:
-	std::string m_prefix;	//<@brief The prefix corresponding to the FIB entry
+	int m_prefixId;	//<@brief The ID, in the name table, of the highest level prefix corresponding to the FIB entry
 	int m_face;		//<@brief The face associated with the FIB entry
 	float m_metric;		//<@brief The metric associated with the FIB entry. 
 };
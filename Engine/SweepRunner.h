@@ -0,0 +1,126 @@
+// SweepRunner.h
+// The sweep runner runs the experiments listed in the configuration file concurrently, each in a worker process of its own.
+// An experiment keeps its whole state in global variables: the nodes, the file names, the name table, the counters, the
+// random number generator, and stdout and stderr, which it redirects into its output files. A worker process forked
+// right before the experiment starts gets a private copy of all of it, so the experiments cannot interfere with each other,
+// and every experiment produces the same output as when the experiments are run one after another in a single process.
+// At most a given number of workers run at the same time; with a single worker the experiments are run in the main process.
+#ifndef SWEEP_RUNNER_H
+#define SWEEP_RUNNER_H
+
+//#include <vld.h>
+
+#include <map>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <ctime>
+#include <unistd.h>
+#include <sys/wait.h>
+
+using namespace std;
+
+class SweepRunner
+{
+	public:
+	SweepRunner(int workersNum)
+	{
+		m_workersNum = workersNum;
+		m_isWorker = false;
+		m_workers = map<pid_t, string>();
+		m_failuresNum = 0;
+		m_startTime = getWallTime();
+	}
+
+	/**
+	<@function. acceptsExperiments
+	<@brief. Check if the process may start another experiment. A worker process runs only the experiment it was forked for.
+	*/
+	bool acceptsExperiments() const
+	{
+		return !m_isWorker;
+	}
+
+	/**
+	<@function. startExperiment
+	<@brief. Start an experiment in a worker process, after waiting for a running worker to finish if all the workers are busy.
+	<@param. experiment, the name of the experiment, which is reported when its worker finishes.
+	<@return. Return true in the process that has to run the experiment, i.e., the new worker, or the main process if there
+		is only a single worker or the worker cannot be forked. Return false in the main process otherwise.
+	*/
+	bool startExperiment(const string& experiment)
+	{
+		if(m_workersNum <= 1)
+			return true;
+		while((int)m_workers.size() >= m_workersNum)
+			waitWorker();
+		cout.flush();
+		cerr.flush();
+		fflush(NULL);	// Nothing buffered by the main process should be written twice.
+		pid_t pid = fork();
+		if(-1 == pid)
+		{
+			cerr << "Cannot fork a worker for " << experiment << ", running it in the main process." << endl;
+			return true;
+		}
+		if(0 == pid)
+		{
+			m_isWorker = true;
+			m_workers.clear();
+			return true;
+		}
+		m_workers[pid] = experiment;
+		return false;
+	}
+
+	/**
+	<@function. waitAll
+	<@brief. Wait for all the running workers to finish.
+	<@return. The number of experiments whose workers failed.
+	*/
+	int waitAll()
+	{
+		while(!m_workers.empty())
+			waitWorker();
+		return m_failuresNum;
+	}
+
+	private:
+	/**
+	<@function. waitWorker
+	<@brief. Wait for any of the running workers to finish, and report how it finished.
+	*/
+	void waitWorker()
+	{
+		int status;
+		pid_t pid = wait(&status);
+		if(-1 == pid)
+		{// There is no worker to wait for.
+			m_workers.clear();
+			return;
+		}
+		map<pid_t, string>::iterator iter = m_workers.find(pid);
+		if(m_workers.end() == iter)
+			return;
+		bool succeeded = WIFEXITED(status) && 0 == WEXITSTATUS(status);
+		if(!succeeded)
+			++m_failuresNum;
+		cout << iter->second << (succeeded ? " finished" : " failed") << " after " << getWallTime() - m_startTime << " s" << endl;
+		m_workers.erase(iter);
+	}
+
+	double getWallTime() const
+	{
+		timespec time;
+		clock_gettime(CLOCK_MONOTONIC, &time);
+		return time.tv_sec + time.tv_nsec/1e9;
+	}
+
+	int m_workersNum;	//<@brief. The maximum number of workers running at the same time.
+	bool m_isWorker;	//<@brief. Whether the process is a worker.
+	map<pid_t, string> m_workers;	//<@brief. The running workers, with the experiments they run.
+	int m_failuresNum;	//<@brief. The number of experiments whose workers failed.
+	double m_startTime;	//<@brief. The wall-clock time at which the sweep started, in seconds.
+};
+
+#endif
@@ -0,0 +1,202 @@
+// Topology.h
+// The topologies the experiments are run on. A topology reads an experiment from a line of the configuration file, whose
+// columns depend on the topology, builds the network of the experiment, and names the output files of the experiment the way
+// the experiments on the topology have always named them. RealNetworkTopology is the topology extracted from CAIDA,
+// BinaryTreeTopology the k-ary trees, and HeavyEdgeTreeTopology the heavy edge trees, see README.md.
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+//#include <vld.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <istream>
+
+#include "utility.h"
+#include "Graph.h"
+using namespace std;
+
+extern int nodesNum;
+extern vector<int> producers;
+extern vector<int> routers;
+extern vector<int> users;
+extern vector<pair<int, int> > links;
+extern string experiment;
+extern int file_number;
+extern int capacity;
+extern int spread_factor;
+extern int delegateRouterNumber;
+
+class Topology
+{
+	public:
+	/**
+	<@function. Topology
+	<@param. hopRatioMetric, the metric part of the name of the file the hop ratios of an experiment are written into.
+	<@param. reuseTimeMetric, the metric part of the name of the file the reuse times of the cached Data packets are written into.
+	<@param. extension, the extension of the data files.
+	*/
+	Topology(const string& hopRatioMetric, const string& reuseTimeMetric, const string& extension)
+	{
+		m_hopRatioMetric = hopRatioMetric;
+		m_reuseTimeMetric = reuseTimeMetric;
+		m_extension = extension;
+	}
+
+	/**
+	<@function. getOutputFileName
+	<@brief. Get the name of an output file of the current experiment, i.e., data/<experiment>_<scheme><metric><variant><extension>.
+	<@param. scheme, the name of the routing scheme.
+	<@param. metric, the metric written into the file, e.g., "_retrievalLatency".
+	<@param. variant, the variant of the scheme, e.g., "_050" for ProSta with the caching probability 0.5, may be empty.
+	<@param. extension, the extension of the file.
+	*/
+	string getOutputFileName(const string& scheme, const string& metric, const string& variant, const string& extension) const
+	{
+		return "data/" + experiment + "_" + scheme + metric + variant + extension;
+	}
+
+	const string& getHopRatioMetric() const
+	{
+		return m_hopRatioMetric;
+	}
+
+	const string& getReuseTimeMetric() const
+	{
+		return m_reuseTimeMetric;
+	}
+
+	const string& getExtension() const
+	{
+		return m_extension;
+	}
+
+	private:
+	string m_hopRatioMetric;	//<@brief. The metric part of the name of the file of the hop ratios.
+	string m_reuseTimeMetric;	//<@brief. The metric part of the name of the file of the reuse times.
+	string m_extension;	//<@brief. The extension of the data files.
+};
+
+class RealNetworkTopology : public Topology
+{
+	public:
+	RealNetworkTopology() : Topology("_hopRatio", "_reuseRatio", ".dt")
+	{
+		m_dataset = "";
+	}
+
+	/**
+	<@function. readExperiment
+	<@brief. Read the next experiment of the configuration file, i.e., its name, the number of clients connected to each client
+		delegate, the number of files, the content store capacity, the dataset, and the number of client delegates.
+	<@return. If there is no more experiment, the function returns false.
+	*/
+	bool readExperiment(istream& config)
+	{
+		return static_cast<bool>(config >> experiment >> spread_factor >> file_number >> capacity >> m_dataset >> delegateRouterNumber);
+	}
+
+	/**
+	<@function. construct
+	<@brief. Build the network of the experiment out of the dataset, and read the highest level prefixes of the producers.
+	<@param. prefixes, a reference variable, the prefixes will be saved in it.
+	*/
+	void construct(vector<string>& prefixes)
+	{
+		string routersFileName = "data/routers@" + m_dataset + ".dt";
+		string linksFileName = "data/links@" + m_dataset + ".dt";
+		constructRealNetwork(routersFileName, linksFileName, nodesNum, producers, routers, users, links);
+		topologyGraph = Graph(nodesNum, links);
+		prefixes.clear();
+		ifstream inFile;
+		inFile.open("data/highestLevelPrefixes.dt");
+		string tempPrefix;
+		while(inFile >> tempPrefix)
+		{
+			prefixes.push_back(tempPrefix);
+		}
+	}
+
+	private:
+	string m_dataset;	//<@brief. The dataset the routers and the links of the network are read from.
+};
+
+class BinaryTreeTopology : public Topology
+{
+	public:
+	BinaryTreeTopology() : Topology("", "_reuseTime", ".data")
+	{
+		m_height = 0;
+	}
+
+	/**
+	<@function. readExperiment
+	<@brief. Read the next experiment of the configuration file, i.e., its name, the number of files, the content store capacity,
+		and the height and the spread factor of the tree.
+	<@return. If there is no more experiment, the function returns false.
+	*/
+	bool readExperiment(istream& config)
+	{
+		return static_cast<bool>(config >> experiment >> file_number >> capacity >> m_height >> spread_factor);
+	}
+
+	/**
+	<@function. construct
+	<@brief. Build the tree of the experiment. The single producer at its root supplies the prefix "google".
+	<@param. prefixes, a reference variable, the prefixes will be saved in it.
+	*/
+	void construct(vector<string>& prefixes)
+	{
+		constructNetworkTopologyKary(spread_factor, m_height, nodesNum, producers, routers, users, links);
+		topologyGraph = Graph(nodesNum, links);
+		prefixes.clear();
+		prefixes.push_back("google");
+	}
+
+	private:
+	int m_height;	//<@brief. The height of the tree.
+};
+
+class HeavyEdgeTreeTopology : public Topology
+{
+	public:
+	HeavyEdgeTreeTopology() : Topology("", "_reuseTime", ".data")
+	{
+		m_height = 0;
+		m_upperSpreadFactor = 0;
+		m_lowerSpreadFactor = 0;
+	}
+
+	/**
+	<@function. readExperiment
+	<@brief. Read the next experiment of the configuration file, i.e., its name, the number of files, the content store capacity,
+		the height of the tree, and the spread factors of the upper part and the lower part of the tree.
+	<@return. If there is no more experiment, the function returns false.
+	*/
+	bool readExperiment(istream& config)
+	{
+		return static_cast<bool>(config >> experiment >> file_number >> capacity >> m_height >> m_upperSpreadFactor >> m_lowerSpreadFactor);
+	}
+
+	/**
+	<@function. construct
+	<@brief. Build the heavy edge tree of the experiment. The single producer at its root supplies the prefix "google".
+	<@param. prefixes, a reference variable, the prefixes will be saved in it.
+	*/
+	void construct(vector<string>& prefixes)
+	{
+		constructNetworkTopologyHeavyEdge(m_upperSpreadFactor, m_height - 1, m_lowerSpreadFactor, nodesNum, producers, routers, users, links);
+		topologyGraph = Graph(nodesNum, links);
+		prefixes.clear();
+		prefixes.push_back("google");
+	}
+
+	private:
+	int m_height;	//<@brief. The height of the tree.
+	int m_upperSpreadFactor;	//<@brief. The spread factor of the upper part of the tree.
+	int m_lowerSpreadFactor;	//<@brief. The spread factor of the lower part of the tree, i.e., the number of clients connected to each client delegate.
+};
+
+#endif
@@ -0,0 +1,228 @@
+// UnmetInterestTable.h
+// The unmet Interest table of an end user keeps the Interest packets the user has initiated whose Data packets have not come
+// back yet, keyed by their names, so a returned Data packet is matched to its Interest packet in constant time. Every Interest
+// packet is kept with the tick it was issued at, from which the retrieval latency of its Data packet is worked out. The
+// Interest packets are also kept in the order they were issued, so the ones that have been unmet for longer than the timeout
+// are found from the front of that order without scanning the table, counted as timed out and given up, i.e., dropped from
+// the table, so that the table holds only the Interest packets still waiting. A Data packet that comes back late, after its
+// Interest packet timed out, matches nothing in the table. An Interest packet known never to be met, as a nack Data packet came
+// back for it or its Data packet was dropped, is dropped from the table as well and counted apart.
+#ifndef UNMET_INTEREST_TABLE_H
+#define UNMET_INTEREST_TABLE_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <unordered_map>
+#include <iostream>
+
+#include "NameTable.h"
+#include "RingQueue.h"
+using namespace std;
+
+/**
+<@brief. An Interest packet in the unmet Interest table.
+*/
+struct UnmetInterest
+{
+	int m_id;	//<@brief. The ID of the Interest packet.
+	int m_issueTime;	//<@brief. The tick the Interest packet was issued at.
+};
+
+/**
+<@brief. An Interest packet in the order the Interest packets were issued in.
+*/
+struct IssuedInterest
+{
+	Name m_name;	//<@brief. The name of the Interest packet.
+	int m_id;	//<@brief. The ID of the Interest packet.
+	int m_issueTime;	//<@brief. The tick the Interest packet was issued at.
+};
+
+class UnmetInterestTable
+{
+	public:
+	UnmetInterestTable()
+	{
+		m_interests = unordered_map<Name, vector<UnmetInterest>, NameHash>();
+		m_issueOrder = RingQueue<IssuedInterest>();
+		m_size = 0;
+		m_timedOutNum = 0;
+		m_droppedNum = 0;
+	}
+
+	/**
+	<@function. insertInterest
+	<@brief. Record an Interest packet initiated by the end user.
+	<@param. name, the name of the Interest packet.
+	<@param. id, the ID of the Interest packet.
+	<@param. issueTime, the tick the Interest packet is issued at.
+	<@param. timeout, the number of ticks after which the Interest packet is counted as timed out, or 0 if it never times out.
+	*/
+	void insertInterest(const Name& name, int id, int issueTime, int timeout)
+	{
+		UnmetInterest interest;
+		interest.m_id = id;
+		interest.m_issueTime = issueTime;
+		m_interests[name].push_back(interest);
+		++m_size;
+		if(0 < timeout)
+		{
+			IssuedInterest issuedInterest;
+			issuedInterest.m_name = name;
+			issuedInterest.m_id = id;
+			issuedInterest.m_issueTime = issueTime;
+			m_issueOrder.push_back(issuedInterest);
+		}
+	}
+
+	/**
+	<@function. satisfyInterest
+	<@brief. Match a returned Data packet to the Interest packet of the same name and ID it answers, and drop the Interest packet
+		from the table.
+	<@param. name, the name of the Data packet.
+	<@param. id, the ID of the Data packet, i.e., of the Interest packet it answers.
+	<@param. now, the tick the Data packet is received at.
+	<@param. latency, a reference variable, the retrieval latency of the Data packet will be saved in it if the Data packet is matched.
+	<@return. If there is no unmet Interest packet of the name and the ID, the function returns false.
+	*/
+	bool satisfyInterest(const Name& name, int id, int now, int& latency)
+	{
+		unordered_map<Name, vector<UnmetInterest>, NameHash>::iterator iter = m_interests.find(name);
+		if(m_interests.end() == iter)
+			return false;
+		vector<UnmetInterest>& interests = iter->second;
+		for(vector<UnmetInterest>::iterator interestIter(interests.begin()), end(interests.end());
+			interestIter != end; ++interestIter)
+		{
+			if(id == interestIter->m_id)
+			{
+				latency = now - interestIter->m_issueTime;
+				interests.erase(interestIter);
+				if(interests.empty())
+					m_interests.erase(iter);
+				--m_size;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	<@function. dropInterest
+	<@brief. Drop an Interest packet that will never be met from the table.
+	<@param. name, the name of the Interest packet.
+	<@param. id, the ID of the Interest packet.
+	<@return. If there is no unmet Interest packet of the name and the ID, the function returns false.
+	*/
+	bool dropInterest(const Name& name, int id)
+	{
+		unordered_map<Name, vector<UnmetInterest>, NameHash>::iterator iter = m_interests.find(name);
+		if(m_interests.end() == iter)
+			return false;
+		vector<UnmetInterest>& interests = iter->second;
+		for(vector<UnmetInterest>::iterator interestIter(interests.begin()), end(interests.end());
+			interestIter != end; ++interestIter)
+		{
+			if(id == interestIter->m_id)
+			{
+				interests.erase(interestIter);
+				if(interests.empty())
+					m_interests.erase(iter);
+				--m_size;
+				++m_droppedNum;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	<@function. expireInterests
+	<@brief. Count the unmet Interest packets that were issued at least timeout ticks ago as timed out, and drop them from the table.
+	<@param. now, the current tick.
+	<@param. timeout, the number of ticks after which an Interest packet is counted as timed out, or 0 if it never times out.
+	<@return. The number of Interest packets newly timed out.
+	*/
+	int expireInterests(int now, int timeout)
+	{
+		int timedOutNum = 0;
+		if(0 >= timeout)
+			return timedOutNum;
+		while(!m_issueOrder.empty() && m_issueOrder.front().m_issueTime + timeout <= now)
+		{
+			const IssuedInterest& issuedInterest = m_issueOrder.front();
+			unordered_map<Name, vector<UnmetInterest>, NameHash>::iterator iter = m_interests.find(issuedInterest.m_name);
+			if(m_interests.end() != iter)
+			{
+				vector<UnmetInterest>& interests = iter->second;
+				for(vector<UnmetInterest>::iterator interestIter(interests.begin()), end(interests.end());
+					interestIter != end; ++interestIter)
+				{
+					if(issuedInterest.m_id == interestIter->m_id)
+					{
+						interests.erase(interestIter);
+						if(interests.empty())
+							m_interests.erase(iter);
+						--m_size;
+						++timedOutNum;
+						break;
+					}
+				}
+			}
+			m_issueOrder.pop_front();
+		}
+		m_timedOutNum += timedOutNum;
+		return timedOutNum;
+	}
+
+	/**
+	<@function. getSize
+	<@brief. Get the number of unmet Interest packets.
+	*/
+	int getSize() const
+	{
+		return m_size;
+	}
+
+	/**
+	<@function. getTimedOutNum
+	<@brief. Get the number of Interest packets counted as timed out and dropped from the table so far.
+	*/
+	int getTimedOutNum() const
+	{
+		return m_timedOutNum;
+	}
+
+	/**
+	<@function. getDroppedNum
+	<@brief. Get the number of Interest packets dropped as they will never be met.
+	*/
+	int getDroppedNum() const
+	{
+		return m_droppedNum;
+	}
+
+	/**
+	<@function. print
+	<@brief. Print the names of the unmet Interest packets, with the ticks they were issued at.
+	*/
+	void print() const
+	{
+		for(unordered_map<Name, vector<UnmetInterest>, NameHash>::const_iterator iter(m_interests.begin()), end(m_interests.end());
+			iter != end; ++iter)
+			for(vector<UnmetInterest>::const_iterator interestIter(iter->second.begin()), interestEnd(iter->second.end());
+				interestIter != interestEnd; ++interestIter)
+				cout << iter->first << " issued at " << interestIter->m_issueTime << endl;
+	}
+
+	private:
+	unordered_map<Name, vector<UnmetInterest>, NameHash> m_interests;	//<@brief. The unmet Interest packets by their names, in the order they were issued.
+	RingQueue<IssuedInterest> m_issueOrder;	//<@brief. The Interest packets in the order they were issued, including the ones met since, which
+		// are skipped when they reach the front. Kept only when there is a timeout.
+	int m_size;	//<@brief. The number of unmet Interest packets.
+	int m_timedOutNum;	//<@brief. The number of Interest packets counted as timed out.
+	int m_droppedNum;	//<@brief. The number of Interest packets dropped as they will never be met.
+};
+
+#endif
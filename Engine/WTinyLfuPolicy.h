@@ -0,0 +1,130 @@
+// WTinyLfuPolicy.h
+// The W-TinyLFU replacement policy of Einziger, Friedman and Manes's "TinyLFU: A Highly Efficient Cache Admission Policy". A
+// newly cached Data packet enters a small LRU window, a hundredth of the cache. The rest of the cache is a segmented LRU, whose
+// probation segment holds the Data packets admitted from the window and whose protected segment, four fifths of it, holds those
+// hit again in probation. A Data packet leaving the window is admitted into the main cache only if the frequency sketch estimates
+// it has been requested more often lately than the Data packet it would displace, the least recently used one in probation;
+// otherwise it is evicted itself. Every hit and every miss of the content store is counted in the sketch. The size of the cache
+// is the number of Data packets the content store holds when it is full, and the sketch is sized for it once.
+#ifndef W_TINY_LFU_POLICY_H
+#define W_TINY_LFU_POLICY_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "ReplacementPolicy.h"
+#include "FrequencySketch.h"
+using namespace std;
+
+class WTinyLfuPolicy : public ReplacementPolicy
+{
+	public:
+	WTinyLfuPolicy()
+	{
+		m_lists = SlotLists(3);
+		m_names = vector<Name>();
+		m_sketch = FrequencySketch();
+		m_capacity = 0;
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new WTinyLfuPolicy(*this);
+	}
+
+	void setCapacity(int dataPacketsNum)
+	{
+		m_capacity = dataPacketsNum;
+		m_sketch.ensureCapacity(m_capacity);
+	}
+
+	void insert(int slot, const Name& name, bool atFront)
+	{
+		if((int)m_names.size() <= slot)
+			m_names.resize(slot + 1);
+		m_names[slot] = name;
+		if(atFront)
+			m_lists.pushFront(window, slot);
+		else m_lists.pushBack(window, slot);
+	}
+
+	void access(int slot, const Name& name)
+	{
+		m_sketch.increment(name);
+		int list = m_lists.getList(slot);
+		if(probation == list)
+		{
+			m_lists.moveToFront(protectedSegment, slot);
+			int mainCapacity = m_capacity - getWindowCapacity();
+			if(m_lists.size(protectedSegment) > mainCapacity*4/5)
+				m_lists.moveToFront(probation, m_lists.back(protectedSegment));
+		}
+		else m_lists.moveToFront(list, slot);
+	}
+
+	void miss(const Name& name)
+	{
+		m_sketch.increment(name);
+	}
+
+	int victim()
+	{
+		int mainCapacity = m_capacity - getWindowCapacity();
+		while(m_lists.size(window) > getWindowCapacity())
+		{
+			int candidate = m_lists.back(window);
+			int mainSize = m_lists.size(probation) + m_lists.size(protectedSegment);
+			if(mainSize < mainCapacity)
+			{
+				m_lists.moveToFront(probation, candidate);
+				continue;
+			}
+			int displaced = 0 < m_lists.size(probation) ? m_lists.back(probation) : m_lists.back(protectedSegment);
+			if(m_sketch.estimate(m_names[candidate]) > m_sketch.estimate(m_names[displaced]))
+			{
+				m_lists.moveToFront(probation, candidate);
+				return displaced;
+			}
+			return candidate;
+		}
+		if(0 < m_lists.size(probation))
+			return m_lists.back(probation);
+		if(0 < m_lists.size(protectedSegment))
+			return m_lists.back(protectedSegment);
+		return m_lists.back(window);
+	}
+
+	void erase(int slot, const Name&)
+	{
+		m_lists.remove(slot);
+	}
+
+	int first() const
+	{
+		return m_lists.first();
+	}
+
+	int next(int slot) const
+	{
+		return m_lists.next(slot);
+	}
+
+	private:
+	int getWindowCapacity() const
+	{
+		return max(1, m_capacity/100);
+	}
+
+	static const int protectedSegment = 0;	//<@brief. The protected segment of the main cache, walked first.
+	static const int probation = 1;	//<@brief. The probation segment of the main cache.
+	static const int window = 2;	//<@brief. The window.
+
+	SlotLists m_lists;	//<@brief. The protected segment, the probation segment and the window, each in LRU order.
+	vector<Name> m_names;	//<@brief. The name of the Data packet in every slot.
+	FrequencySketch m_sketch;	//<@brief. The estimated frequencies of the names requested lately.
+	int m_capacity;	//<@brief. The size of the cache, i.e., the number of Data packets the content store holds when it is full.
+};
+
+#endif
@@ -0,0 +1,190 @@
+// WeightedPolicy.h
+// The popularity-weighted replacement policy. Every cached Data packet has a priority: it is cached with the weight of its file,
+// i.e., the probability the file is requested by fileProbabilities, every hit adds the weight again, and the Data packet
+// of the lowest priority is evicted. The priorities age as in the weighted mode the content stores once had, which took the
+// weight of the lowest Data packet off every Data packet whenever one was cached and sorted them again; here the aging is a single
+// offset the priorities of new Data packets are raised by instead, and the slots are kept in an indexed binary min-heap, so every
+// operation takes O(log n) time. The Data packets of the same priority are evicted from the least recently cached or hit one.
+#ifndef WEIGHTED_POLICY_H
+#define WEIGHTED_POLICY_H
+
+//#include <vld.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "ReplacementPolicy.h"
+#include "NameTable.h"
+using namespace std;
+
+extern vector<float> fileProbabilities;
+
+class WeightedPolicy : public ReplacementPolicy
+{
+	public:
+	WeightedPolicy()
+	{
+		m_heap = vector<int>();
+		m_positions = vector<int>();
+		m_priorities = vector<double>();
+		m_stamps = vector<unsigned long long>();
+		m_clock = 0;
+		m_nextInOrder = vector<int>();
+	}
+
+	ReplacementPolicy* clone() const
+	{
+		return new WeightedPolicy(*this);
+	}
+
+	/**
+	<@brief. The Data packet is given the lowest priority of the Data packets cached, plus the weight of its file if atFront is
+		set, so that a Data packet cached at the least favourable position is the next to be evicted unless it is hit.
+	*/
+	void insert(int slot, const Name& name, bool atFront)
+	{
+		reserve(slot);
+		double inflation = m_heap.empty() ? 0 : m_priorities[m_heap.front()];
+		m_priorities[slot] = atFront ? inflation + getWeight(name) : inflation;
+		m_stamps[slot] = ++m_clock;
+		m_positions[slot] = m_heap.size();
+		m_heap.push_back(slot);
+		siftUp(m_positions[slot]);
+	}
+
+	void access(int slot, const Name& name)
+	{
+		m_priorities[slot] += getWeight(name);
+		m_stamps[slot] = ++m_clock;
+		siftDown(m_positions[slot]);
+	}
+
+	int victim()
+	{
+		return m_heap.front();
+	}
+
+	void erase(int slot, const Name&)
+	{
+		int position = m_positions[slot];
+		int last = m_heap.back();
+		m_heap.pop_back();
+		m_positions[slot] = -1;
+		if(last == slot)
+			return;
+		m_heap[position] = last;
+		m_positions[last] = position;
+		siftUp(position);
+		siftDown(m_positions[last]);
+	}
+
+	/**
+	<@brief. The Data packets are walked from the highest priority to the lowest one. The heap is not in that order, so the order
+		is sorted out when the walk begins, which takes O(n log n) time; the walks are only made to print the content stores.
+	*/
+	int first() const
+	{
+		if(m_heap.empty())
+			return -1;
+		vector<int> order(m_heap);
+		sort(order.begin(), order.end(), KeptLonger(*this));
+		m_nextInOrder.assign(m_positions.size(), -1);
+		for(int i = 0; i + 1 < (int)order.size(); ++i)
+			m_nextInOrder[order[i]] = order[i + 1];
+		return order.front();
+	}
+
+	int next(int slot) const
+	{
+		return m_nextInOrder[slot];
+	}
+
+	private:
+	/**
+	<@brief. Orders the slots from the one kept longest to the next one to be evicted.
+	*/
+	struct KeptLonger
+	{
+		KeptLonger(const WeightedPolicy& policy) : m_policy(policy)
+		{
+		}
+
+		bool operator()(int left, int right) const
+		{
+			return m_policy.isEvictedBefore(right, left);
+		}
+
+		const WeightedPolicy& m_policy;
+	};
+
+	/**
+	<@function. getWeight
+	<@brief. Get the weight of the file of a Data packet, the probability the file is requested.
+	*/
+	static float getWeight(const Name& name)
+	{
+		return fileProbabilities[name.fileId];
+	}
+
+	bool isEvictedBefore(int left, int right) const
+	{
+		if(m_priorities[left] != m_priorities[right])
+			return m_priorities[left] < m_priorities[right];
+		return m_stamps[left] < m_stamps[right];
+	}
+
+	void siftUp(int position)
+	{
+		int slot = m_heap[position];
+		while(position > 0)
+		{
+			int parent = (position - 1)/2;
+			if(!isEvictedBefore(slot, m_heap[parent]))
+				break;
+			m_heap[position] = m_heap[parent];
+			m_positions[m_heap[position]] = position;
+			position = parent;
+		}
+		m_heap[position] = slot;
+		m_positions[slot] = position;
+	}
+
+	void siftDown(int position)
+	{
+		int slot = m_heap[position];
+		int size = m_heap.size();
+		while(true)
+		{
+			int child = 2*position + 1;
+			if(child >= size)
+				break;
+			if(child + 1 < size && isEvictedBefore(m_heap[child + 1], m_heap[child]))
+				++child;
+			if(!isEvictedBefore(m_heap[child], slot))
+				break;
+			m_heap[position] = m_heap[child];
+			m_positions[m_heap[position]] = position;
+			position = child;
+		}
+		m_heap[position] = slot;
+		m_positions[slot] = position;
+	}
+
+	void reserve(int slot)
+	{
+		if(slot < (int)m_positions.size())
+			return;
+		m_positions.resize(slot + 1, -1);
+		m_priorities.resize(slot + 1, 0);
+		m_stamps.resize(slot + 1, 0);
+	}
+
+	vector<int> m_heap;	//<@brief. The slots in a binary min-heap, the next one to be evicted at the top.
+	vector<int> m_positions;	//<@brief. The position of every slot in the heap, or -1 if it is not cached.
+	vector<double> m_priorities;	//<@brief. The priority of every slot.
+	vector<unsigned long long> m_stamps;	//<@brief. When every slot was last cached or hit, to break the ties of the priorities.
+	unsigned long long m_clock;	//<@brief. The number of times a slot has been cached or hit.
+	mutable vector<int> m_nextInOrder;	//<@brief. The slot following every slot in the walk begun by the last call of first.
+};
+
+#endif
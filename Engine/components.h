@@ -55,14 +55,24 @@ typedef struct FaceMetric
 */
 typedef struct ContentStoreStat
 {
-	string prefix;
+	int fileId;	// The file, in the name table, the Data packets belong to.
 	int count;
 	bool operator==(const ContentStoreStat& other)
 	{
-		return prefix == other.prefix;
+		return fileId == other.fileId;
 	}
 } ContentStoreStat;
 
+/**
+<@brief. A record of the timing wheel of a dynamic FIB, saying that a face of an entry expires at a given time.
+*/
+typedef struct FaceExpiry
+{
+	int fileId;
+	int face;
+	int expiryTime;
+} FaceExpiry;
+
 /**
 <@brief. There will be a list of PitInfo in every PIT entry. Every instance of PitInfo corresponds to 
 	a coming Interest packet.
@@ -85,7 +95,7 @@ struct PitInfo
 		m_distance = other.m_distance;
 		m_interestPacketId = other.m_interestPacketId;
 	}
-	void print()
+	void print() const
 	{
 		cout << "distance = " << m_distance << ", hopCount = " << m_hopCount << ", arrivalFace = " 
 			<< m_arrivalFace << ", id = " << m_interestPacketId << endl;
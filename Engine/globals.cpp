@@ -0,0 +1,95 @@
+//globals.cpp
+//<@brief: The parameters of the simulation and the state of the current experiment, shared by the modules of every routing scheme.
+//	The nodes of a scheme are kept by its Node type, in Node<CachePolicy, RoutingPolicy>::nodes.
+#include <fstream>
+#include <utility>
+#include <vector>
+#include <string>
+#include <map>
+
+#include "NameTable.h"
+#include "Scheduler.h"
+#include "EventQueue.h"
+#include "PacketPool.h"
+#include "Graph.h"
+#include "EgoBetweenness.h"
+#include "PopularitySampler.h"
+#include "CachingHash.h"
+#include "ReplacementPolicy.h"
+#include "Random.h"
+using namespace std;
+
+typedef unsigned short int crc;
+
+int fibFaceLifetime = 10;	//<@brief. The preset life time of a fib associated with a dynamic FIB entry.
+bool fibFaceExpiry = false;	//<@brief. Whether the faces of dynamic FIB entries expire fibFaceLifetime rounds after they were last renewed.
+int linkDelay = 1;	//<@brief. The time (in ticks, i.e., rounds) a packet takes to travel over a link. If a packet is sent with no delay, it may travel
+	// several hops in a round, as in the round-based simulation.
+int processingDelay = 0;	//<@brief. The time (in ticks) a node takes to process a packet before sending it on.
+int sweepWorkersNum = 0;	//<@brief. The maximum number of experiments run at the same time, each in a worker process. 0 means one per hardware
+	// thread. It can be overridden by the first command-line argument.
+int nodesNum;	//<@brief. The total number of nodes in the network.
+vector<int> producers;	//<@brief. The IDs of the producers.
+vector<int> routers;	//<@brief. The IDs of the routers.
+vector<int> users;	//<@brief. The IDs of end users.
+vector<pair<int, int> > links; //<@brief. The links in the network. Each pair represents a link in the network, with each element
+		// in the pair represent the ID of a end point of the link.
+Graph topologyGraph;	//<@brief. The adjacency of the network, built out of links by the topology of the experiment.
+EgoBetweenness egoBetweenness;	//<@brief. The ego network betweenness centrality of the routers of the experiment.
+bool egoBetweennessCentrality = false;	//<@brief. Whether the ego network betweenness centrality of the routers is computed, which no scheme uses
+	// at present. It is set by the command-line option "betweenness".
+map<int, string> idPrefix; //<@brief. The container is used to maintain the 
+		//IDs of producers and the highest level prefix corresponding to each producer.
+Scheduler scheduler;	//<@brief. Decides which nodes are visited in every round of the simulation, and in which order.
+EventQueue eventQueue;	//<@brief. The clock of the simulation, holding the packets in flight over the links.
+PacketPool<InterestPacket> interestPacketPool;	//<@brief. The Interest packets in flight and in the queues of the nodes.
+PacketPool<DataPacket> dataPacketPool;	//<@brief. The Data packets in flight and in the queues of the nodes.
+int nodeQueueCapacity = 0;	//<@brief. The largest number of Interest packets, and of Data packets, queued up at a node; the packets
+	// arriving at a full queue are dropped. 0 means the queues are unbounded.
+int interestTimeout = 100;	//<@brief. The number of ticks after which an Interest packet initiated by an end user is counted as timed out, and
+	// given up, if its Data packet has not come back; a Data packet coming back later counts as unmatched. 0 means the Interest packets
+	// never time out.
+int occupancyDumpInterval = 0;	//<@brief. The number of rounds between two dumps of how many chunks of every file the content store of every router
+	// holds, into the _occupancy output file of the scheme. 0 means the content stores are not dumped.
+int pitEntryLifetime;	//<@brief. The preset life time of a PIT entry.
+vector<string> fileNames;	//<@brief. The vector contains the fileNames the network could supply. 
+NameTable nameTable;	//<@brief. Interns the file names and the highest level prefixes the packets refer to.
+float zipfAlpha = 0.75;	//<@brief. The exponent of the Zipf-like distribution the files in fileNames are requested with.
+PopularitySampler::Method popularitySamplerMethod = PopularitySampler::binarySearch;	//<@brief. How the files requested are drawn. binarySearch
+	// keeps the cumulative distribution of the files, aliasTable the alias table, and rejectionInversion needs no memory per file.
+PopularitySampler popularitySampler;	//<@brief. Draws the files the end users request.
+unsigned long long randomSeed = 0;	//<@brief. The seed all the random number streams of an experiment are split off.
+Random setupRandom;	//<@brief. The random number stream of the set-up of an experiment, i.e., of the topology and the file names.
+CachingHash::Mode cachingHashMode = CachingHash::compatible;	//<@brief. How the routers hash the requested files in the election of the caching
+	// routers. compatible elects the routers the salted file names always have, seeded hashes the file IDs under a seed of every router.
+CachingHash cachingHash;	//<@brief. Gives the hash value every router bids with for every file.
+ReplacementPolicy::Type replacementPolicyType = ReplacementPolicy::lru;	//<@brief. The replacement policy of the content stores of the routers.
+	// It can be overridden by the second command-line argument, see ReplacementPolicies.h for the names.
+bool replacementPolicyTiming = false;	//<@brief. Whether the content stores time their replacement policies, which the experiments then report.
+bool cacheAdmission = false;	//<@brief. Whether the Data packets the routers cache on their paths, under PerSta and ProSta, must pass an admission
+	// filter before they displace cached ones, see AdmissionFilter.h. It is set by the command-line option "admission".
+int cacheAdmissionFrequency = 2;	//<@brief. The number of recent requests of a name, counting the one being answered, the admission filter
+	// requires of a Data packet. 2 rejects the names requested once lately.
+int responsePacketNum = 0;		//<@brief. The total number of responsee Data packets we have received.
+long long cachedPacketNum = 0;	//<@brief. The total number of Data packets that has been cached in the network.
+vector<float> fileProbabilities;	//<@brief. The probability that every file would be accessed, by its ID in nameTable.
+int cacheThreshold = 1;	//<@brief. The threshold to cache a Data packet. If the distance from the provider to the caching router is less 
+	//than the threshold, the provider will tag the response Data packet as nocache. So the response won't be cache in the caching router.
+ofstream reuseTime;	//<@brief. Output the reuse time of the Data packets in the content store of all the routers into the file.
+ofstream retrievalLatency;	//<@brief. Output the retrieval latency (in ticks) of every Data packet returned to an end user into the file.
+long long totalRetrievalLatency;	//<@brief. The sum of the retrieval latencies of the Data packets returned to the end users.
+ofstream PLCR;
+crc crcLookupTable[256];
+int packetId;	//<@brief. The variable is used to identify an Interest packet and its corresponding Data packet uniquely.
+ofstream peekFile;	//<@brief. Some information need to be observed will be outputed into the file.
+int requiredHopNum;	//<@brief. The number of hops needed to fetch the Data packets back when no in-router caching exists.
+int measuredHopNum;	//<@brief. The number of hops needed to fetch the Data packets back when the in-router caching exists.
+int lowerPacketNumLimit;	//<@brief. When the id of the Data or Interest packet is larger than or equal to this limit, 
+	//record the hop information about the packet.
+int upperPacketNumLimit;	//<@brief. When the id of the Data or Interest packet is less than or equal to this limit,
+	//record the hop information about the packet.
+int file_number;	//<brief. The number of files corresponding to a single prefix.
+int capacity;	//<brief. The times of the total content store capacity over  the total file size in the network.
+int spread_factor;	//<brief. How many clients are connected to a client delegate router in the real network, or the spread factor of the k-ary tree.
+string experiment;	//<brief. The experiment to be carried out.
+int delegateRouterNumber;	//<brief. The number of delegate routers in the network. The variable is used in the real network simulations only.
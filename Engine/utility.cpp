@@ -17,15 +17,19 @@
 
 #include "components.h"
 #include "utility.h"
+#include "Random.h"
+#include "Graph.h"
+#include "EgoBetweenness.h"
 //#include "Node.h"
 //#include "NetworkConfig.h"
 using namespace std;
 
 extern int nodesNum;
-extern vector<pair<int, int> > links;
 extern int file_number;
 extern int spread_factor;
 extern int delegateRouterNumber;
+extern vector<pair<int, int> > links;
+extern Random setupRandom;
 
 typedef unsigned short int crc;
 extern crc crcLookupTable[256];
@@ -86,34 +90,15 @@ void parseProducerConfigFile(map<int, string>& pairs)
 <@function. constructShortestPath
 <@brief. Construct the shortest path for a given node to any other nodes in the network.
 <@param. origin, the node for which we will construct the shortest pathes.
-<@param. nodesNum, the number of nodes in the network.
-<@param. links, the links between nodes in the network.
+<@param. graph, the adjacency of the network.
 <@param. pathInfos, a reference variable. It record the nexthop and metric corresponding to the shortest path to any other node.
 		The ith element of the container records the information for the ith nodes.
 <@attention. The function applies to a simplified model where the metric between any two joint nodes is 1.
 */
-void constructShortestPath(int origin, int nodesNum, vector<pair<int, int> > links, vector<PathInfo>& pathInfos)
+void constructShortestPath(int origin, const Graph& graph, vector<PathInfo>& pathInfos)
 {
 	pathInfos.clear();
-	//int metric[nodesNum][nodesNum];
-	//int** metric = new int[nodesNum][nodesNum];
-	int** metric = new int*[nodesNum];
-	for(int i = 0; i < nodesNum; ++i)
-		metric[i] = new int[nodesNum];
-	for(int i = 0; i < nodesNum; ++i)
-		for(int j = 0; j < nodesNum; ++j)
-			metric[i][j] = -1;
-
-	vector<pair<int, int> >::iterator iter(links.begin()), end(links.end());
-	for(; iter != end; ++iter)
-	{
-		int node1 = iter->first;
-		int node2 = iter->second;
-		metric[node1][node2] = 1;
-		metric[node2][node1] = 1;
-	}
-
-	for(int i = 0; i < nodesNum; ++i)
+	for(int i = 0; i < graph.getNodesNum(); ++i)
 	{
 		PathInfo pathInfo;
 		pathInfo.flag = false;
@@ -131,9 +116,11 @@ void constructShortestPath(int origin, int nodesNum, vector<pair<int, int> > lin
 	{
 		int temp = que.front();
 		que.pop();
-		for(int i = 0; i < nodesNum; ++i)
+		const int* neighbours = graph.getNeighbours(temp);
+		for(int k = 0; k < graph.getDegree(temp); ++k)
 		{
-			if(false == pathInfos[i].flag && 1 == metric[temp][i])
+			int i = neighbours[k];
+			if(false == pathInfos[i].flag)
 			{
 				pathInfos[i].metric = pathInfos[temp].metric + 1;
 				pathInfos[i].flag = true;
@@ -149,16 +136,6 @@ void constructShortestPath(int origin, int nodesNum, vector<pair<int, int> > lin
 			}
 		}
 	}
-
-	//delete [] *metric;
-	//delete [] metric;
-	if(NULL != metric)
-	{
-		for(int i = 0; i < nodesNum; ++i)
-			delete [] metric[i];
-		delete [] metric;
-		metric = NULL;
-	}
 }
 
 /**
@@ -186,116 +163,16 @@ string trimLastComponentFromName(string name)
 
 /**
 <@function. computeBetweennessCentrality
-<@brief. Compute the ego network betweenness centrality of a given node.
+<@brief. Compute the ego network betweenness centrality of a given node in topologyGraph. The centralities of many nodes are
+	computed at once, in parallel, by EgoBetweenness::compute.
 <@param. origin, the node for which we will compute the ego network centrality betweenness.
 <@return. the ego network betweenness centrality of the given node.
 */
 float computeBetweennssCentrality(int origin)
 {
-//	int& nodesNum = NetworkConfig::m_nodesNum;
-//	vector<pair<int, int> >& links = NetworkConfig::m_links;
-//	int metric[nodesNum][nodesNum];
-	int** metric = new int*[nodesNum];
-	for(int i = 0; i < nodesNum; ++i)
-		metric[i] = new int[nodesNum];
-
-	for(int i = 0; i < nodesNum; ++i)
-		for(int j = 0; j < nodesNum; ++j)
-			metric[i][j] = 0;
-	
-	for(vector<pair<int, int> >::iterator iter(links.begin()), end(links.end());
-		iter != end; ++iter)
-	{
-		int node1 = iter->first;
-		int node2 = iter->second;
-		metric[node1][node2] = 1;
-		metric[node2][node1] = 1;	
-	}
-	
-	vector<int> alters;
-	alters.push_back(origin);
-	for(int i = 0; i < nodesNum; ++i)
-	{
-		if(1 == metric[origin][i])
-		{
-			alters.push_back(i);
-		}
-	}
-	
-	int matrixLength = alters.size();
-	//int adjacencyMatrix[matrixLength][matrixLength];
-	int** adjacencyMatrix = new int*[matrixLength];
-	for(int i = 0; i < matrixLength; ++i)
-		adjacencyMatrix[i] = new int[matrixLength];
-
-	for(int i = 0; i < matrixLength; ++i)
-		for(int j = 0; j < matrixLength; ++j)
-		{
-			int node1 = alters[i];
-			int node2 = alters[j];
-			adjacencyMatrix[i][j] = metric[node1][node2];
-		}
-//			adjacencyMatrix[i][j] = 0;
-	
-	//int resultMatrix[matrixLength][matrixLength];
-	int** resultMatrix = new int*[matrixLength];
-	for(int i = 0; i < matrixLength; ++i)
-		resultMatrix[i] = new int[matrixLength];
-
-	for(int i = 0; i < matrixLength; ++i)
-		for(int j = 0; j < matrixLength; ++j)
-		{
-			int temp = 0;
-			for(int k = 0; k < matrixLength; ++k)
-				temp += adjacencyMatrix[i][k]*adjacencyMatrix[k][j];
-				resultMatrix[i][j] = temp;
-		}
-	
-	for(int i = 0; i < matrixLength; ++i)
-		for(int j = 0; j < matrixLength; ++j)
-			adjacencyMatrix[i][j] = 1 - adjacencyMatrix[i][j];
-	
-	for(int i = 0; i < matrixLength; ++i)
-		for(int j = 0; j < matrixLength; ++j)
-			resultMatrix[i][j] = resultMatrix[i][j]*adjacencyMatrix[i][j];
-
-	float ret = 0;
-	for(int i = 0; i < matrixLength; ++i)
-		for(int j = i + 1; j < matrixLength; ++j)
-			if(0 != resultMatrix[i][j])
-			{
-				ret +=  1/float(resultMatrix[i][j]);
-			}
-	//delete [] *metric;
-	//delete [] metric;
-	if(NULL != metric)
-	{
-		for(int i = 0; i < nodesNum; ++i)
-			delete [] metric[i];
-		delete [] metric;
-		metric = NULL;
-	}
-
-	//delete [] *adjacencyMatrix;
-	//delete [] adjacencyMatrix;
-	if(NULL != adjacencyMatrix)
-	{
-		for(int i = 0; i < matrixLength; ++i)
-			delete [] adjacencyMatrix[i];
-		delete [] adjacencyMatrix;
-		adjacencyMatrix = NULL;
-	}
-
-	//delete [] *resultMatrix;
-	//delete [] resultMatrix;
-	if(NULL != resultMatrix)
-	{
-		for(int i = 0; i < matrixLength; ++i)
-			delete [] resultMatrix[i];
-		delete [] resultMatrix;
-		resultMatrix = NULL;
-	}
-	return ret;
+	vector<int> alterPositions(topologyGraph.getNodesNum(), -1);
+	vector<unsigned long long> rows;
+	return EgoBetweenness::computeCentrality(topologyGraph, origin, alterPositions, rows);
 }
 
 /**
@@ -308,11 +185,25 @@ float computeBetweennssCentrality(int origin)
 string generateRandomString(int value, int length)
 {
 	string source = "1234567890qwertyuioplkjhgfdsazxcvbnmQWERTYUIOPLKJHGFDSAZXCVBNM";
-	srand(value);
+	// The characters are the ones rand()%62 draws after srand(value) in the GNU C library, but the generator of the
+	// library is run on a local state, so the string depends on the value only and no random number stream is disturbed.
+	vector<int> r(344 + length);
+	r[0] = (0 == value) ? 1 : value;
+	for(int i = 1; i < 31; ++i)
+	{
+		long long word = (16807LL*r[i - 1])%2147483647;
+		if(word < 0)
+			word += 2147483647;
+		r[i] = word;
+	}
+	for(int i = 31; i < 34; ++i)
+		r[i] = r[i - 31];
+	for(int i = 34; i < 344 + length; ++i)
+		r[i] = (unsigned)r[i - 31] + (unsigned)r[i - 3];
 	string ret = "";
 	for(int i = 0; i < length; ++i)
 	{
-		int index = rand()%62;
+		int index = ((unsigned)r[344 + i] >> 1)%62;
 		ret = ret + source[index];
 	}
 	return ret;
@@ -343,17 +234,14 @@ float hashStringToNum(string str)
 
 /**
 <@function. generateFileNames
-<@brief. Generate a set of file names that the network could supply as well as the probability the files are requested.
-	The users will choose files from the file name set following probability generated here.
+<@brief. Generate a set of file names that the network could supply. The files are ranked by their popularity in the order
+	they are stored, and the users choose files from the set through the popularity sampler.
 <@param. prefixes, the set of highest level prefixes in the network. For every highest prefix, the function will generate 100 file names for it.
 <@param. fileNames, a reference variable, a container of vector, used to maintain the file names. 
-<@param. fileRequestProbability, a vector defining the probability the files identified by the filenames in fileNames are requested.
-	The probability the files will be requested follows zipf-like distribution with alpha equals 0.75
 */
-void generateFileNames(vector<string> prefixes, vector<string>& fileNames, vector<float>& fileRequestProbability)
+void generateFileNames(vector<string> prefixes, vector<string>& fileNames)
 {
 	fileNames.clear();
-	fileRequestProbability.clear();
 	for(vector<string>::iterator prefixIter(prefixes.begin()), prefixEnd(prefixes.end());
 		prefixIter != prefixEnd; ++prefixIter)
 	{
@@ -362,34 +250,22 @@ void generateFileNames(vector<string> prefixes, vector<string>& fileNames, vecto
 			string filename = *prefixIter + "/";
 			//srand((unsigned)time(0));
 			
-			int randomNum = rand();
+			int randomNum = setupRandom.nextInt(RAND_MAX);
 			string temp = generateRandomString(randomNum, 10);
 			filename = filename + temp + "/" + "100";
 			
-			/*randomNum = rand();
+			/*randomNum = setupRandom.nextInt(RAND_MAX);
 			temp = generateRandomString(randomNum, 10);
 			filename = filename + temp + "/";
 			
-			randomNum = rand();
+			randomNum = setupRandom.nextInt(RAND_MAX);
 			temp = generateRandomString(randomNum, 10);
 			filename = filename + temp + "/" + "100";*/
 			
 			fileNames.push_back(filename);
 		}
-		random_shuffle(fileNames.begin(), fileNames.end());
+		random_shuffle(fileNames.begin(), fileNames.end(), setupRandom);
 	}	
-	int length = fileNames.size();
-	float sum = 0;
-	for(int i = 0; i < length; ++i)
-	{
-		float floatI = i + 1;
-		float exponent = 0.75;
-		float temp = 1/pow(floatI, exponent);
-		sum += temp;
-		fileRequestProbability.push_back(sum);
-	}
-	for(int i = 0; i < length; ++i)
-		fileRequestProbability[i] = fileRequestProbability[i]/sum;
 }
 
 
@@ -8,6 +8,7 @@
 //#include <vld.h>
 
 #include "components.h"
+#include "Graph.h"
 using namespace std;
 
 typedef unsigned short int crc;
@@ -45,13 +46,12 @@ void parseProducerConfigFile(map<int, string>& pairs);
 <@function. constructShortestPath
 <@brief. Construct the shortest path for a given node to any other nodes in the network.
 <@param. origin, the node for which we will construct the shortest pathes.
-<@param. nodesNum, the number of nodes in the network.
-<@param. links, the links between nodes in the network.
+<@param. graph, the adjacency of the network.
 <@param. pathInfos, a reference variable. It record the nexthop and metric corresponding to the shortest path to any other node.
 		The ith element of the container records the information for the ith nodes.
 <@attention. The function applies to a simplified model where the metric between any two joint nodes is 1.
 */
-void constructShortestPath(int origin, int nodesNum, vector<pair<int, int> > links, vector<PathInfo>& pathInfos);
+void constructShortestPath(int origin, const Graph& graph, vector<PathInfo>& pathInfos);
 
 /**
 <@function. trimLastComponentFromName
@@ -89,14 +89,12 @@ float hashStringToNum(string str);
 
 /**
 <@function. generateFileNames
-<@brief. Generate a set of file names that the network could supply as well as the probability the files are requested.
-	The users will choose files from the file name set following probability generated here.
+<@brief. Generate a set of file names that the network could supply. The files are ranked by their popularity in the order
+	they are stored, and the users choose files from the set through the popularity sampler.
 <@param. prefixes, the set of highest level prefixes in the network. For every highest prefix, the function will generate 100 file names for it.
 <@param. fileNames, a reference variable, a container of vector, used to maintain the file names. 
-<@param. fileRequestProbability, a vector defining the probability the files identified by the filenames in fileNames are requested.
-	The probability the files will be requested follows zipf-like distribution with alpha equals 0.75
 */
-void generateFileNames(vector<string> prefixes, vector<string>& fileNames, vector<float>& fileRequestProbability);
+void generateFileNames(vector<string> prefixes, vector<string>& fileNames);
 
 /**
 <@function. vectorSubtraction
@@ -0,0 +1,8 @@
+//lockstep
+#include "../../Engine/Experiment.h"
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+	return runLockstepExperiments<BinaryTreeTopology>(argc, argv);
+}
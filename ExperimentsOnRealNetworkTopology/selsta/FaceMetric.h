@@ -1,30 +0,0 @@
-// FaceCost.h
-// The class is used when we want a sequence of ranked faces to forward a Interest packet.
-#ifndef FACE_METRIC_H
-#define FACE_METRIC_H
-
-//#include <vld.h>
-
-//class FaceMetric
-//{
-//	public:
-////	FaceCost(uint_32 face, float cost)
-////	{
-////		m_face = face;
-////		m_cost = cost;
-////	}
-//	//private:
-//	FaceCost(int face, float metric)
-//	{
-//		m_face = face;
-//		m_metric = metric;
-//	}
-//	int m_face;
-//	float m_metric;
-//	bool operator<(const FaceCost& other) const
-//	{
-//		return m_metric < other.m_metric;
-//	}
-//};
-
-#endif